@@ -1,25 +1,74 @@
 #ifndef APP_CONTROLLER_H
 #define APP_CONTROLLER_H
 
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 #include "model/translator.h"
 #include "model/fasta_parser.h"
+#include "model/protein_properties.h"
+#include "model/motif_scanner.h"
+#include "model/protein_index.h"
+#include "model/protein_aligner.h"
+#include "model/translation_workspace.h"
 #include "view/visualizer.h"
+#include "view/html_report.h"
+
+struct RunOptions {
+    bool verbose = false;
+    bool visualize = false;
+    bool properties = false;
+    std::string motifsFile;
+    std::string alignReference;   // FASTA whose first record is the reference
+    AlignmentOptions alignment;
+    unsigned threads = 0;         // parser threads, 0 for one per core
+    std::string reportFile;
+};
+
+// State loaded once per run and shared by every record
+struct RunContext {
+    MotifScanner motifs;
+    std::string referenceName;
+    std::string referenceProtein;
+    std::unique_ptr<HtmlReport> report;
+};
 
 class AppController {
 public:
     AppController();
 
-    int runFile(const std::string& filepath, bool verbose, bool visualize) const;
-    int runString(const std::string& dna, bool verbose, bool visualize) const;
+    int runFile(const std::string& filepath, const RunOptions& options) const;
+    int runString(const std::string& dna, const RunOptions& options) const;
+    int runIndex(const std::string& filepath, const std::string& indexPath,
+                 bool allFrames) const;
+    int runQuery(const std::string& indexPath, const std::vector<std::string>& peptides,
+                 const std::string& peptideFile) const;
 
 private:
     Translator translator_;
     FastaParser parser_;
+    ProteinAnalyzer analyzer_;
+    ProteinAligner aligner_;
     Visualizer visualizer_;
 
-    void processSequence(const Sequence& seq, bool verbose, bool visualize) const;
+    // False if the file cannot be opened; visit returns false to stop early
+    bool forEachRecord(const std::string& filepath, unsigned threads,
+                       const std::function<bool(const FastaRecord&)>& visit) const;
+    int prepareRun(const RunOptions& options, RunContext& context) const;
+    int finishRun(RunContext& context) const;
+    // report is the run's HtmlReport, or nullptr when none was requested
+    void processSequence(const FastaRecord& record, const RunOptions& options,
+                         const RunContext& context, HtmlReport* report,
+                         TranslationWorkspace& workspace) const;
+    void printMotifMatches(const MotifScanner& motifs,
+                           const std::vector<MotifMatch>& matches) const;
+    void printProperties(const ProteinProperties& props) const;
+    void printAlignmentSummary(const PairwiseAlignment& alignment,
+                               const std::string& referenceName) const;
     void printSeparator() const;
+    void printQueryHits(const ProteinIndex& index, const std::string& peptide,
+                        std::vector<IndexHit>& hits) const;
 };
 
 #endif
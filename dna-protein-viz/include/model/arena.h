@@ -0,0 +1,39 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/**
+ * Bump allocator for short-lived record data. Everything handed out is
+ * released at once by reset(), which keeps the blocks for reuse, so a
+ * steady stream of similar batches stops allocating after warm-up.
+ */
+class Arena {
+public:
+    explicit Arena(size_t blockSize = 64 * 1024);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena(Arena&&) = default;
+    Arena& operator=(Arena&&) = default;
+
+    char* allocate(size_t bytes);
+    std::string_view copy(std::string_view text);
+    void reset();
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks_;
+    size_t blockSize_;
+    size_t current_;   // index of the block being filled
+    size_t used_;      // bytes used in the current block
+};
+
+#endif
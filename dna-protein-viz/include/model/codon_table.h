@@ -10,6 +10,8 @@ public:
     CodonTable();
 
     char translateCodon(const std::string& codon) const;
+    // Allocation-free lookup for DNA or RNA bases (upper case)
+    char translateCodon(char first, char second, char third) const;
     bool isValidCodon(const std::string& codon) const;
     bool isStartCodon(const std::string& codon) const;
     bool isStopCodon(const std::string& codon) const;
@@ -20,7 +22,9 @@ public:
 
 private:
     std::map<std::string, char> codon_table_;
+    char codon_lookup_[64];
     void initializeCodonTable();
+    void initializeLookup();
 };
 
 #endif
@@ -1,10 +1,64 @@
 #ifndef FASTA_PARSER_H
 #define FASTA_PARSER_H
 
+#include <fstream>
 #include <string>
+#include <string_view>
 #include <vector>
+#include "model/arena.h"
+#include "model/mapped_file.h"
 #include "model/sequence.h"
 
+// Name and description point into the parsed input, DNA into the batch arena
+struct FastaRecord {
+    std::string_view name;
+    std::string_view description;
+    std::string_view dna;
+};
+
+// Records of one batch; their DNA lives in the arena until clear()
+struct RecordBatch {
+    Arena arena;
+    std::vector<FastaRecord> records;
+
+    void clear() {
+        arena.reset();
+        records.clear();
+    }
+};
+
+// One byte range of the input and the buffers its parser thread reuses
+struct FastaShard {
+    std::string dna;
+    RecordBatch batch;
+};
+
+/**
+ * FASTA input handed out in windows of whole records. Regular files are
+ * memory-mapped; pipes, /dev/stdin and process substitution are read in
+ * chunks, keeping the partial record after the last header for the next
+ * window, so either way only about one window is in memory at a time.
+ */
+class FastaInput {
+public:
+    FastaInput();
+
+    bool open(const std::string& filepath);
+
+    // Next run of whole records of roughly windowBytes, valid until the
+    // following call; false once the input is exhausted
+    bool nextWindow(size_t windowBytes, const char*& begin, const char*& end);
+
+private:
+    MappedFile mapped_;
+    std::ifstream stream_;
+    std::string buffer_;
+    size_t position_;   // mapped: next window start; streamed: bytes of buffer_ handed out
+    bool streaming_;
+
+    bool readChunk(size_t bytes);
+};
+
 class FastaParser {
 public:
 
@@ -12,10 +66,18 @@ public:
     std::vector<Sequence> parseFile(const std::string& filepath) const;
     Sequence parseString(const std::string& dna) const;
 
+//Parse [begin, end) of an in-memory FASTA image, one thread per shard.
+//The range is split at record headers; shards[k] receives the k-th part in input order
+    void parseSharded(const char* begin, const char* end,
+                      std::vector<FastaShard>& shards) const;
+
 private:
-    void parseHeader(const std::string& line,
-                     std::string& name,
-                     std::string& description) const;
+    void parseRange(const char* begin, const char* end, FastaShard& shard) const;
+    void parseHeader(std::string_view line,
+                     std::string_view& name,
+                     std::string_view& description) const;
+    void emitRecord(std::string_view name, std::string_view description,
+                    FastaShard& shard) const;
 };
 
 #endif
@@ -0,0 +1,44 @@
+#ifndef MOTIF_SCANNER_H
+#define MOTIF_SCANNER_H
+
+#include <string>
+#include <vector>
+
+struct MotifMatch {
+    int motif;      // index of the motif, see getMotif()
+    int position;   // 1-based start position in the protein
+};
+
+/**
+ * Multi-pattern peptide search using an Aho-Corasick automaton.
+ * All motifs are compiled into one flat DFA so the cost of scanning a
+ * protein depends only on its length and the number of hits.
+ */
+class MotifScanner {
+public:
+    MotifScanner();
+
+    bool loadFile(const std::string& filepath);
+    bool addMotif(const std::string& motif);
+
+    // Driven one residue at a time by the translator as it emits the protein
+    int initialState() const;
+    int step(int state, char aminoAcid) const;
+    void collect(int state, int position, std::vector<MotifMatch>& matches) const;
+
+    const std::string& getMotif(int index) const;
+    bool empty() const;
+
+private:
+    static const int ALPHABET = 26;
+
+    bool appendMotif(const std::string& motif);
+    void build();
+
+    std::vector<std::string> motifs_;
+    std::vector<int> transitions_;     // state * ALPHABET + symbol -> state
+    std::vector<int> outputOffsets_;   // state -> range in outputMotifs_
+    std::vector<int> outputMotifs_;
+};
+
+#endif
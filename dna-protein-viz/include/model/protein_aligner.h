@@ -0,0 +1,69 @@
+#ifndef PROTEIN_ALIGNER_H
+#define PROTEIN_ALIGNER_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+enum class AlignmentMode { Global, Local };
+
+struct AlignmentOptions {
+    AlignmentMode mode = AlignmentMode::Global;
+    int gapOpen = 11;     // a gap of length k costs gapOpen + k * gapExtend
+    int gapExtend = 1;
+    int band = -1;        // max distance from the diagonal (at least 1), -1 for unbanded
+};
+
+struct PairwiseAlignment {
+    int score = 0;
+    std::string alignedQuery;       // with '-' for gaps
+    std::string alignedReference;
+    int queryStart = 0;             // 1-based, inclusive
+    int queryEnd = 0;
+    int referenceStart = 0;
+    int referenceEnd = 0;
+    int identities = 0;
+    int positives = 0;
+    int gaps = 0;
+};
+
+// DP buffers kept between calls so repeated alignments reuse their capacity
+struct AlignmentScratch {
+    std::vector<int> diagLow;
+    std::vector<size_t> diagOffset;
+    std::vector<uint8_t> trace;
+    std::vector<uint8_t> queryCodes;
+    std::vector<uint8_t> reversedRef;
+    std::vector<int32_t> h[3];
+    std::vector<int32_t> e[2];
+    std::vector<int32_t> f[2];
+    std::vector<int32_t> scores;
+};
+
+/**
+ * BLOSUM62 / affine gap pairwise protein alignment (Gotoh). The DP is
+ * evaluated one anti-diagonal at a time: cells on a diagonal do not
+ * depend on each other, so the inner loop runs 4 cells per SSE2 step.
+ */
+class ProteinAligner {
+public:
+    ProteinAligner();
+
+    PairwiseAlignment align(const std::string& query,
+                            const std::string& reference,
+                            const AlignmentOptions& options) const;
+    void align(const std::string& query,
+               const std::string& reference,
+               const AlignmentOptions& options,
+               PairwiseAlignment& result,
+               AlignmentScratch& scratch) const;
+
+    static int substitutionScore(char a, char b);
+
+private:
+    int8_t blosum_[26][26];
+
+    void initializeMatrix();
+};
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef PROTEIN_INDEX_H
+#define PROTEIN_INDEX_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "model/mapped_file.h"
+
+/**
+ * On-disk layout (native endianness, every section 8-byte aligned):
+ *
+ *   IndexHeader
+ *   IndexEntry[entryCount]      one per indexed protein
+ *   char names[namesBytes]      NUL-terminated record names
+ *   char text[textBytes]        proteins, each followed by a '#' separator
+ *   int32 sa[textBytes]         suffix array of text
+ *   int32 lcp[textBytes]        LCP of neighbouring suffixes in sa
+ */
+struct IndexHeader {
+    char magic[8];
+    uint32_t entryCount;
+    uint32_t reserved;
+    uint64_t namesBytes;
+    uint64_t textBytes;
+};
+
+struct IndexEntry {
+    uint32_t textStart;
+    uint32_t length;
+    uint32_t nameOffset;
+    int32_t frame;        // 1..3 forward, -1..-3 reverse complement
+};
+
+struct IndexHit {
+    int entry;
+    int position;         // 1-based position in the protein
+};
+
+class ProteinIndexWriter {
+public:
+    ProteinIndexWriter();
+
+    bool addProtein(const std::string& name, int frame, const std::string& protein);
+    bool write(const std::string& filepath) const;
+
+    size_t getProteinCount() const;
+    size_t getResidueCount() const;
+
+private:
+    std::vector<IndexEntry> entries_;
+    std::string names_;
+    std::string text_;
+    size_t residues_;
+};
+
+class ProteinIndex {
+public:
+    ProteinIndex();
+
+    bool load(const std::string& filepath);
+
+    // Exact lookup in O(m log n) plus the number of hits
+    void find(const std::string& peptide, std::vector<IndexHit>& hits) const;
+
+    const char* getName(int entry) const;
+    int getFrame(int entry) const;
+
+private:
+    MappedFile file_;
+    const IndexEntry* entries_;
+    const char* names_;
+    const char* text_;
+    const int32_t* sa_;
+    const int32_t* lcp_;
+    uint32_t entryCount_;
+    uint64_t namesBytes_;
+    uint64_t textBytes_;
+
+    bool validateEntries() const;
+    int compareSuffix(int32_t suffix, const std::string& peptide) const;
+    int entryAt(int32_t textPos) const;
+};
+
+#endif
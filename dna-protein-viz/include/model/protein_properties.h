@@ -0,0 +1,35 @@
+#ifndef PROTEIN_PROPERTIES_H
+#define PROTEIN_PROPERTIES_H
+
+#include <string>
+
+struct ProteinProperties {
+    double molecularWeight;   // average mass in Daltons
+    double isoelectricPoint;
+    double gravy;             // Kyte-Doolittle grand average of hydropathy
+    double netCharge;         // at pH 7.0
+};
+
+class ProteinAnalyzer {
+public:
+    ProteinAnalyzer();
+
+    // Compute all properties in a single pass over the protein
+    ProteinProperties analyze(const std::string& protein) const;
+
+private:
+    struct ChargeCounts {
+        int lys, arg, his, asp, glu, cys, tyr;
+        bool hasTermini;
+    };
+
+    double residueMass_[256];
+    double hydropathy_[256];
+    bool known_[256];
+
+    void initializeTables();
+    double chargeAt(const ChargeCounts& counts, double pH) const;
+    double solveIsoelectricPoint(const ChargeCounts& counts) const;
+};
+
+#endif
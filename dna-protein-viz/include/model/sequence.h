@@ -2,6 +2,7 @@
 #define SEQUENCE_H
 
 #include <string>
+#include <string_view>
 
 class Sequence {
 public:
@@ -10,16 +11,17 @@ public:
              const std::string& description = "");
     Sequence();
 
-    std::string getDNA() const;
-    std::string getProtein() const;
-    std::string getName() const;
-    std::string getDescription() const;
+    const std::string& getDNA() const;
+    const std::string& getProtein() const;
+    const std::string& getName() const;
+    const std::string& getDescription() const;
     int getLength() const;
 
     void setProtein(const std::string& protein);
     void setDNA(const std::string& dna);
 
     bool isValid() const;
+    static bool isValidDNA(std::string_view dna);
 
 private:
     std::string dna_;
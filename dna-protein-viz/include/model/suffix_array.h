@@ -0,0 +1,29 @@
+#ifndef SUFFIX_ARRAY_H
+#define SUFFIX_ARRAY_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * Linear-time suffix array construction (SA-IS, Nong/Zhang/Chan)
+ * and Kasai LCP computation over a byte string.
+ */
+class SuffixArray {
+public:
+    // Text must not contain '\0'; it is used as the internal sentinel
+    static std::vector<int32_t> build(const std::string& text);
+
+    // lcp[i] = longest common prefix of suffixes sa[i - 1] and sa[i], lcp[0] = 0
+    static std::vector<int32_t> buildLCP(const std::string& text,
+                                         const std::vector<int32_t>& sa);
+
+private:
+    static void sais(const int32_t* text, int32_t* sa, int32_t n, int32_t alphabet);
+    static void getBuckets(const int32_t* text, int32_t n, int32_t alphabet,
+                           std::vector<int32_t>& buckets, bool bucketEnds);
+    static void induceSort(const int32_t* text, int32_t* sa, int32_t n, int32_t alphabet,
+                           const std::vector<char>& isS, std::vector<int32_t>& buckets);
+};
+
+#endif
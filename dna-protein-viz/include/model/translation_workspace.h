@@ -0,0 +1,23 @@
+#ifndef TRANSLATION_WORKSPACE_H
+#define TRANSLATION_WORKSPACE_H
+
+#include <vector>
+#include "model/translator.h"
+#include "model/motif_scanner.h"
+#include "model/protein_aligner.h"
+
+/**
+ * Per-thread scratch space for the record pipeline. Every buffer keeps
+ * its capacity from one record to the next, so once the workspace has
+ * seen the largest record the translate path stops allocating.
+ * Not shared between threads; give each worker its own. Parser threads
+ * keep their buffers in FastaShard.
+ */
+struct TranslationWorkspace {
+    TranslationResult result;
+    std::vector<MotifMatch> matches;
+    PairwiseAlignment alignment;
+    AlignmentScratch alignmentScratch;
+};
+
+#endif
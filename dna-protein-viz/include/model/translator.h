@@ -2,7 +2,10 @@
 #define TRANSLATOR_H
 
 #include <string>
+#include <string_view>
+#include <vector>
 #include "model/codon_table.h"
+#include "model/motif_scanner.h"
 #include "model/sequence.h"
 
 struct TranslationResult {
@@ -21,9 +24,30 @@ public:
     double calculateGCContent(const std::string& dna) const;
     TranslationResult translate(const Sequence& sequence) const;
 
+    std::string reverseComplement(const std::string& dna) const;
+    // Translate a whole reading frame (1..3 forward, -1..-3 reverse),
+    // keeping stop codons as '*' instead of stopping at the first one
+    std::string translateFrame(const std::string& dna, int frame) const;
+
+    // Translate into an existing result, reusing the capacity of its
+    // strings so that steady-state translation does not allocate. The
+    // second form also scans each residue for motifs as it is emitted
+    void translateInto(std::string_view dna, TranslationResult& result) const;
+    void translateInto(std::string_view dna, TranslationResult& result,
+                       const MotifScanner& scanner,
+                       std::vector<MotifMatch>& matches) const;
+
 private:
     CodonTable codonTable_;
     std::string normalizeSequence(const std::string& sequence) const;
+    void normalizeInto(std::string_view sequence, std::string& out) const;
+    void appendProtein(const std::string& mrna, std::string& protein,
+                       const MotifScanner* scanner,
+                       std::vector<MotifMatch>* matches) const;
+    void translateInto(std::string_view dna, TranslationResult& result,
+                       const MotifScanner* scanner,
+                       std::vector<MotifMatch>* matches) const;
+    double gcPercent(const std::string& normalized) const;
 };
 
 #endif
@@ -0,0 +1,92 @@
+#ifndef HTML_REPORT_H
+#define HTML_REPORT_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "model/translator.h"
+#include "model/codon_table.h"
+#include "model/protein_aligner.h"
+
+/**
+ * Reduces an unbounded stream of values to at most a fixed number of
+ * min/max/mean buckets. When all buckets are full, neighbours are merged
+ * pairwise and each bucket covers twice as many values from then on.
+ */
+class TrackDownsampler {
+public:
+    explicit TrackDownsampler(size_t buckets);
+
+    void reset();
+    void add(double value);
+
+    size_t size() const;
+    double getMin(size_t bucket) const;
+    double getMax(size_t bucket) const;
+    double getMean(size_t bucket) const;
+
+private:
+    struct Bucket {
+        double min;
+        double max;
+        double sum;
+        size_t count;
+    };
+
+    std::vector<Bucket> buckets_;
+    size_t used_;
+    size_t span_;   // values per full bucket
+};
+
+/**
+ * Self-contained HTML/SVG report written while records stream past.
+ * Only the first few records get a detailed panel; every record feeds
+ * fixed-size run totals, so file size and render time stay bounded.
+ */
+class HtmlReport {
+public:
+    HtmlReport();
+
+    bool open(const std::string& filepath);
+    void addRecord(std::string_view name,
+                   std::string_view description,
+                   const TranslationResult& result,
+                   const PairwiseAlignment* alignment);
+    bool close();
+
+private:
+    std::ofstream out_;
+    std::string filepath_;
+    CodonTable codonTable_;
+
+    size_t records_;
+    uint64_t totalBases_;
+    uint64_t totalResidues_;
+    uint64_t gcBases_;
+    uint64_t runCodons_[64];
+    uint64_t recordCodons_[64];
+    uint64_t gcHistogram_[20];
+
+    TrackDownsampler gcTrack_;
+    TrackDownsampler baseTracks_[4];
+    TrackDownsampler runGcTrack_;
+
+    void writeHeader();
+    void writeSummary();
+    void writeRecordPanel(std::string_view name,
+                          std::string_view description,
+                          const TranslationResult& result,
+                          const PairwiseAlignment* alignment);
+    void writeSequencePreview(const TranslationResult& result);
+    void writeAlignmentPreview(const PairwiseAlignment& alignment);
+    void writeMinMaxTrack(const TrackDownsampler& track, const char* label, double scale);
+    void writeCompositionTrack();
+    void writeCodonHeatmap(const uint64_t counts[64], const char* title);
+    void writeGCHistogram();
+    void writeEscaped(std::string_view text);
+    void countCodons(const TranslationResult& result, uint64_t counts[64]) const;
+};
+
+#endif
@@ -2,8 +2,10 @@
 #define VISUALIZER_H
 
 #include <string>
+#include <string_view>
 #include "model/translator.h"
 #include "model/codon_table.h"
+#include "model/protein_aligner.h"
 
 class Visualizer {
 public:
@@ -14,6 +16,9 @@ public:
     void displayNucleotideComposition(const std::string& dna) const;
     void displayAlignment(const TranslationResult& result) const;
     void displayGCBar(double gcContent) const;
+    void displayPairwiseAlignment(const PairwiseAlignment& alignment,
+                                  std::string_view queryName,
+                                  std::string_view referenceName) const;
 
 private:
     CodonTable codonTable_;
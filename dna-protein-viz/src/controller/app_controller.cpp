@@ -1,6 +1,12 @@
 #include "controller/app_controller.h"
 #include <iostream>
 #include <iomanip>
+#include <fstream>
+#include <cctype>
+#include <algorithm>
+#include <thread>
+
+static const size_t SHARD_BYTES = 8 << 20;
 
 AppController::AppController() {}
 
@@ -8,25 +14,94 @@ void AppController::printSeparator() const {
     std::cout << "────────────────────────────────────────────────\n";
 }
 
-void AppController::processSequence(const Sequence& seq, bool verbose, bool visualize) const {
-    if (!seq.isValid()) {
+void AppController::printProperties(const ProteinProperties& props) const {
+    std::cout << std::fixed
+              << "MW       : " << std::setprecision(2) << props.molecularWeight << " Da\n"
+              << "pI       : " << std::setprecision(2) << props.isoelectricPoint << "\n"
+              << "GRAVY    : " << std::setprecision(3) << props.gravy << "\n"
+              << "Charge   : " << std::setprecision(2) << props.netCharge << " (pH 7.0)\n";
+}
+
+void AppController::printMotifMatches(const MotifScanner& motifs,
+                                      const std::vector<MotifMatch>& matches) const {
+    for (const MotifMatch& match : matches)
+        std::cout << "Motif    : " << motifs.getMotif(match.motif)
+                  << " at " << match.position << "\n";
+}
+
+void AppController::printAlignmentSummary(const PairwiseAlignment& alignment,
+                                          const std::string& referenceName) const {
+    size_t columns = alignment.alignedQuery.size();
+    double identity = columns > 0 ? 100.0 * alignment.identities / columns : 0.0;
+
+    std::cout << "Align    : score " << alignment.score << ", identity "
+              << alignment.identities << "/" << columns << " ("
+              << std::fixed << std::setprecision(1) << identity << "%), gaps "
+              << alignment.gaps << " vs " << referenceName << "\n";
+}
+
+int AppController::prepareRun(const RunOptions& options, RunContext& context) const {
+    if (!options.motifsFile.empty() && !context.motifs.loadFile(options.motifsFile))
+        return 4;
+
+    if (!options.alignReference.empty()) {
+        std::vector<Sequence> references = parser_.parseFile(options.alignReference);
+        if (references.empty() || !references.front().isValid()) {
+            std::cerr << "Error: no valid reference sequence in '"
+                      << options.alignReference << "'\n";
+            return 7;
+        }
+
+        const Sequence& reference = references.front();
+        context.referenceName = reference.getName().empty() ? "reference" : reference.getName();
+        context.referenceProtein = translator_.translate(reference).protein;
+    }
+
+    if (!options.reportFile.empty()) {
+        context.report.reset(new HtmlReport());
+        if (!context.report->open(options.reportFile))
+            return 8;
+    }
+
+    return 0;
+}
+
+int AppController::finishRun(RunContext& context) const {
+    if (context.report && !context.report->close())
+        return 8;
+    return 0;
+}
+
+void AppController::processSequence(const FastaRecord& record, const RunOptions& options,
+                                    const RunContext& context, HtmlReport* report,
+                                    TranslationWorkspace& workspace) const {
+    const MotifScanner& motifs = context.motifs;
+
+    if (!Sequence::isValidDNA(record.dna)) {
         std::cerr << "Error: invalid DNA sequence";
-        if (!seq.getName().empty())
-            std::cerr << " '" << seq.getName() << "'";
+        if (!record.name.empty())
+            std::cerr << " '" << record.name << "'";
         std::cerr << " (contains non-ATGC characters)\n";
         return;
     }
 
-    TranslationResult result = translator_.translate(seq);
+    TranslationResult& result = workspace.result;
+    std::vector<MotifMatch>& matches = workspace.matches;
+    matches.clear();
+    if (motifs.empty())
+        translator_.translateInto(record.dna, result);
+    else
+        translator_.translateInto(record.dna, result, motifs, matches);
 
-    if (!seq.getName().empty())
-        std::cout << "Sequence : " << seq.getName() << "\n";
-    if (!seq.getDescription().empty())
-        std::cout << "Desc     : " << seq.getDescription() << "\n";
+    if (!record.name.empty())
+        std::cout << "Sequence : " << record.name << "\n";
+    if (!record.description.empty())
+        std::cout << "Desc     : " << record.description << "\n";
 
     std::cout << "Protein  : " << result.protein << "\n";
+    printMotifMatches(motifs, matches);
 
-    if (verbose) {
+    if (options.verbose) {
         std::cout << "DNA      : " << result.dna << "\n";
         std::cout << "mRNA     : " << result.mrna << "\n";
         std::cout << "Length   : " << result.dna.size() << " bp ("
@@ -35,26 +110,89 @@ void AppController::processSequence(const Sequence& seq, bool verbose, bool visu
                   << result.gcContent << "%\n";
     }
 
-    if (visualize) {
+    if (options.properties) {
+        printProperties(analyzer_.analyze(result.protein));
+    }
+
+    PairwiseAlignment& alignment = workspace.alignment;
+    bool aligned = !options.alignReference.empty();
+    if (aligned) {
+        aligner_.align(result.protein, context.referenceProtein, options.alignment,
+                       alignment, workspace.alignmentScratch);
+        printAlignmentSummary(alignment, context.referenceName);
+    }
+
+    if (options.visualize) {
         visualizer_.displayFull(result);
+        if (aligned)
+            visualizer_.displayPairwiseAlignment(alignment, record.name, context.referenceName);
+    }
+
+    if (report) {
+        report->addRecord(record.name, record.description, result,
+                          aligned ? &alignment : nullptr);
     }
 }
 
-int AppController::runFile(const std::string& filepath, bool verbose, bool visualize) const {
-    std::vector<Sequence> sequences = parser_.parseFile(filepath);
+/**
+ * The file is handled in windows of whole records. Each window is parsed
+ * by all threads at once, then its records are handed to visit in input
+ * order while the shard buffers and arenas are reused, so memory does not
+ * grow with the number of records.
+ */
+bool AppController::forEachRecord(const std::string& filepath, unsigned threads,
+                                  const std::function<bool(const FastaRecord&)>& visit) const {
+    FastaInput input;
+    if (!input.open(filepath)) {
+        std::cerr << "Error: cannot open file '" << filepath << "'\n";
+        return false;
+    }
 
-    if (sequences.empty())
-        return 2;
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
 
-    for (size_t i = 0; i < sequences.size(); i++) {
-        if (i > 0) printSeparator();
-        processSequence(sequences[i], verbose, visualize);
+    std::vector<FastaShard> shards(threads);
+    const size_t windowBytes = SHARD_BYTES * threads;
+    const char* begin;
+    const char* end;
+
+    while (input.nextWindow(windowBytes, begin, end)) {
+        parser_.parseSharded(begin, end, shards);
+        for (const FastaShard& shard : shards)
+            for (const FastaRecord& record : shard.batch.records)
+                if (!visit(record))
+                    return true;
     }
+    return true;
+}
 
-    return 0;
+int AppController::runFile(const std::string& filepath, const RunOptions& options) const {
+    RunContext context;
+    int status = prepareRun(options, context);
+    if (status != 0)
+        return status;
+
+    TranslationWorkspace workspace;
+    size_t processed = 0;
+    bool opened = forEachRecord(filepath, options.threads, [&](const FastaRecord& record) {
+        if (processed++ > 0) printSeparator();
+        processSequence(record, options, context, context.report.get(), workspace);
+        return true;
+    });
+
+    // Close the report even when nothing was processed so it stays valid HTML
+    status = finishRun(context);
+    if (!opened)
+        return 2;
+    if (processed == 0) {
+        std::cerr << "Warning: no sequences found in '" << filepath << "'\n";
+        return 2;
+    }
+
+    return status;
 }
 
-int AppController::runString(const std::string& dna, bool verbose, bool visualize) const {
+int AppController::runString(const std::string& dna, const RunOptions& options) const {
     Sequence seq = parser_.parseString(dna);
 
     if (!seq.isValid()) {
@@ -62,6 +200,117 @@ int AppController::runString(const std::string& dna, bool verbose, bool visualiz
         return 3;
     }
 
-    processSequence(seq, verbose, visualize);
+    RunContext context;
+    int status = prepareRun(options, context);
+    if (status != 0)
+        return status;
+
+    FastaRecord record;
+    record.name = seq.getName();
+    record.description = seq.getDescription();
+    record.dna = seq.getDNA();
+
+    TranslationWorkspace workspace;
+    processSequence(record, options, context, context.report.get(), workspace);
+    return finishRun(context);
+}
+
+int AppController::runIndex(const std::string& filepath, const std::string& indexPath,
+                            bool allFrames) const {
+    static const int frames[] = {1, 2, 3, -1, -2, -3};
+    ProteinIndexWriter writer;
+    TranslationResult result;
+    std::string name;
+    std::string dna;
+    size_t records = 0;
+    bool full = false;
+
+    // Only the protein text (and later its suffix array) grows with the input
+    bool opened = forEachRecord(filepath, 0, [&](const FastaRecord& record) {
+        records++;
+        name.assign(record.name.data(), record.name.size());
+        if (!Sequence::isValidDNA(record.dna)) {
+            std::cerr << "Error: skipping invalid DNA sequence '" << name << "'\n";
+            return true;
+        }
+
+        if (allFrames) {
+            dna.assign(record.dna.data(), record.dna.size());
+            for (int frame : frames)
+                if (!writer.addProtein(name, frame, translator_.translateFrame(dna, frame)))
+                    full = true;
+        } else {
+            translator_.translateInto(record.dna, result);
+            if (!writer.addProtein(name, 1, result.protein))
+                full = true;
+        }
+        return !full;
+    });
+
+    if (!opened)
+        return 2;
+    if (records == 0) {
+        std::cerr << "Warning: no sequences found in '" << filepath << "'\n";
+        return 2;
+    }
+    if (full || !writer.write(indexPath))
+        return 5;
+
+    std::cout << "Indexed  : " << writer.getProteinCount() << " proteins ("
+              << writer.getResidueCount() << " residues)\n"
+              << "Index    : " << indexPath << "\n";
+    return 0;
+}
+
+void AppController::printQueryHits(const ProteinIndex& index, const std::string& peptide,
+                                   std::vector<IndexHit>& hits) const {
+    std::string normalized;
+    for (char c : peptide) {
+        if (std::isspace(static_cast<unsigned char>(c))) continue;
+        if (!std::isalpha(static_cast<unsigned char>(c)) && c != '*') {
+            std::cerr << "Warning: skipping invalid peptide '" << peptide << "'\n";
+            return;
+        }
+        normalized += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    if (normalized.empty()) return;
+
+    hits.clear();
+    index.find(normalized, hits);
+    std::sort(hits.begin(), hits.end(), [](const IndexHit& a, const IndexHit& b) {
+        return a.entry != b.entry ? a.entry < b.entry : a.position < b.position;
+    });
+    for (const IndexHit& hit : hits) {
+        int frame = index.getFrame(hit.entry);
+        std::cout << normalized << '\t' << index.getName(hit.entry) << '\t'
+                  << (frame > 0 ? "+" : "") << frame << '\t' << hit.position << '\n';
+    }
+}
+
+int AppController::runQuery(const std::string& indexPath,
+                            const std::vector<std::string>& peptides,
+                            const std::string& peptideFile) const {
+    ProteinIndex index;
+    if (!index.load(indexPath))
+        return 6;
+
+    std::vector<IndexHit> hits;
+    for (const std::string& peptide : peptides)
+        printQueryHits(index, peptide, hits);
+
+    if (!peptideFile.empty()) {
+        std::ifstream file(peptideFile);
+        if (!file.is_open()) {
+            std::cerr << "Error: cannot open file '" << peptideFile << "'\n";
+            return 6;
+        }
+
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            printQueryHits(index, line, hits);
+        }
+    }
+
     return 0;
 }
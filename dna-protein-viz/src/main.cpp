@@ -1,20 +1,91 @@
 #include <iostream>
 #include <cstring>
+#include <cstdlib>
+#include <string>
+#include <vector>
 #include "controller/app_controller.h"
 
 static void printUsage(const char* programName) {
     std::cout << "Usage: " << programName << " <input.fasta> [options]\n"
-              << "       " << programName << " -s <DNA_STRING> [options]\n\n"
+              << "       " << programName << " -s <DNA_STRING> [options]\n"
+              << "       " << programName << " index <input.fasta> <out.idx> [--all-frames]\n"
+              << "       " << programName << " query <index.idx> [PEPTIDE...] [-f <peptides.txt>]\n\n"
               << "Options:\n"
               << "  -h, --help       Show this help message\n"
               << "  -v, --verbose    Show mRNA, GC content, and detailed stats\n"
               << "  -V, --viz        Show full ASCII visualization\n"
-              << "  -s <STRING>      Translate a DNA string directly\n\n"
+              << "  -p, --props      Show MW, pI, GRAVY and net charge of the protein\n"
+              << "  -s <STRING>      Translate a DNA string directly\n"
+              << "  --motifs <FILE>  Report peptide motifs (one per line) found in each protein\n"
+              << "  --align <FILE>   Align each protein against the first record of FILE\n"
+              << "  --local          Use local instead of global alignment\n"
+              << "  --band <N>       Restrict alignment to N cells around the diagonal\n"
+              << "  -j, --threads <N> Parse the input with N threads (default: all cores)\n"
+              << "  --report <FILE>  Write a self-contained HTML/SVG report\n\n"
               << "Examples:\n"
               << "  " << programName << " sequences.fasta\n"
               << "  " << programName << " sequences.fasta -v\n"
+              << "  " << programName << " sequences.fasta -p\n"
+              << "  " << programName << " sequences.fasta --motifs motifs.txt\n"
+              << "  " << programName << " variants.fasta --align reference.fasta -V\n"
+              << "  " << programName << " sequences.fasta --report out.html\n"
               << "  " << programName << " -s ATGAAAGGG -V\n"
-              << "  " << programName << " -s ATGAAAGGG -v -V\n";
+              << "  " << programName << " -s ATGAAAGGG -v -V\n"
+              << "  " << programName << " index sequences.fasta proteome.idx --all-frames\n"
+              << "  " << programName << " query proteome.idx MKGP -f peptides.txt\n";
+}
+
+static int runIndexCommand(int argc, char* argv[]) {
+    bool allFrames = false;
+    std::vector<std::string> paths;
+
+    for (int i = 2; i < argc; i++) {
+        if (std::strcmp(argv[i], "--all-frames") == 0)
+            allFrames = true;
+        else
+            paths.push_back(argv[i]);
+    }
+
+    if (paths.size() != 2) {
+        std::cerr << "Error: index requires <input.fasta> and <out.idx>\n";
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    AppController controller;
+    return controller.runIndex(paths[0], paths[1], allFrames);
+}
+
+static int runQueryCommand(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Error: query requires an index file\n";
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string peptideFile;
+    std::vector<std::string> peptides;
+
+    for (int i = 3; i < argc; i++) {
+        if (std::strcmp(argv[i], "-f") == 0) {
+            if (i + 1 < argc) {
+                peptideFile = argv[++i];
+            } else {
+                std::cerr << "Error: -f requires a file argument\n";
+                return 1;
+            }
+            continue;
+        }
+        peptides.push_back(argv[i]);
+    }
+
+    if (peptides.empty() && peptideFile.empty()) {
+        std::cerr << "Error: no peptides given\n";
+        return 1;
+    }
+
+    AppController controller;
+    return controller.runQuery(argv[2], peptides, peptideFile);
 }
 
 int main(int argc, char* argv[]) {
@@ -23,8 +94,12 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    bool verbose = false;
-    bool visualize = false;
+    if (std::strcmp(argv[1], "index") == 0)
+        return runIndexCommand(argc, argv);
+    if (std::strcmp(argv[1], "query") == 0)
+        return runQueryCommand(argc, argv);
+
+    RunOptions options;
     bool useString = false;
     const char* input = nullptr;
 
@@ -34,11 +109,68 @@ int main(int argc, char* argv[]) {
             return 0;
         }
         if (std::strcmp(argv[i], "-v") == 0 || std::strcmp(argv[i], "--verbose") == 0) {
-            verbose = true;
+            options.verbose = true;
             continue;
         }
         if (std::strcmp(argv[i], "-V") == 0 || std::strcmp(argv[i], "--viz") == 0) {
-            visualize = true;
+            options.visualize = true;
+            continue;
+        }
+        if (std::strcmp(argv[i], "-p") == 0 || std::strcmp(argv[i], "--props") == 0) {
+            options.properties = true;
+            continue;
+        }
+        if (std::strcmp(argv[i], "--motifs") == 0) {
+            if (i + 1 < argc) {
+                options.motifsFile = argv[++i];
+            } else {
+                std::cerr << "Error: --motifs requires a file argument\n";
+                return 1;
+            }
+            continue;
+        }
+        if (std::strcmp(argv[i], "--align") == 0) {
+            if (i + 1 < argc) {
+                options.alignReference = argv[++i];
+            } else {
+                std::cerr << "Error: --align requires a reference FASTA file\n";
+                return 1;
+            }
+            continue;
+        }
+        if (std::strcmp(argv[i], "--report") == 0) {
+            if (i + 1 < argc) {
+                options.reportFile = argv[++i];
+            } else {
+                std::cerr << "Error: --report requires an output file\n";
+                return 1;
+            }
+            continue;
+        }
+        if (std::strcmp(argv[i], "--local") == 0) {
+            options.alignment.mode = AlignmentMode::Local;
+            continue;
+        }
+        if (std::strcmp(argv[i], "--band") == 0) {
+            char* end = nullptr;
+            long band = i + 1 < argc ? std::strtol(argv[i + 1], &end, 10) : -1;
+            if (i + 1 >= argc || *end != '\0' || band < 1) {
+                std::cerr << "Error: --band requires a positive integer\n";
+                return 1;
+            }
+            options.alignment.band = static_cast<int>(band);
+            i++;
+            continue;
+        }
+        if (std::strcmp(argv[i], "-j") == 0 || std::strcmp(argv[i], "--threads") == 0) {
+            char* end = nullptr;
+            long threads = i + 1 < argc ? std::strtol(argv[i + 1], &end, 10) : 0;
+            if (i + 1 >= argc || *end != '\0' || threads < 1) {
+                std::cerr << "Error: --threads requires a positive integer\n";
+                return 1;
+            }
+            options.threads = static_cast<unsigned>(threads);
+            i++;
             continue;
         }
         if (std::strcmp(argv[i], "-s") == 0) {
@@ -68,7 +200,7 @@ int main(int argc, char* argv[]) {
     AppController controller;
 
     if (useString)
-        return controller.runString(input, verbose, visualize);
+        return controller.runString(input, options);
     else
-        return controller.runFile(input, verbose, visualize);
+        return controller.runFile(input, options);
 }
@@ -0,0 +1,39 @@
+#include "model/arena.h"
+#include <algorithm>
+#include <cstring>
+
+Arena::Arena(size_t blockSize)
+    : blockSize_(blockSize), current_(0), used_(0) {}
+
+char* Arena::allocate(size_t bytes) {
+    // Move on to the next block that fits, reusing blocks kept by reset()
+    while (current_ < blocks_.size() && used_ + bytes > blocks_[current_].size) {
+        current_++;
+        used_ = 0;
+    }
+
+    if (current_ == blocks_.size()) {
+        Block block;
+        block.size = std::max(blockSize_, bytes);
+        block.data.reset(new char[block.size]);
+        blocks_.push_back(std::move(block));
+        used_ = 0;
+    }
+
+    char* result = blocks_[current_].data.get() + used_;
+    used_ += bytes;
+    return result;
+}
+
+std::string_view Arena::copy(std::string_view text) {
+    if (text.empty()) return std::string_view();
+
+    char* destination = allocate(text.size());
+    std::memcpy(destination, text.data(), text.size());
+    return std::string_view(destination, text.size());
+}
+
+void Arena::reset() {
+    current_ = 0;
+    used_ = 0;
+}
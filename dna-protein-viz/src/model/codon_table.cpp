@@ -5,6 +5,31 @@
  */
 CodonTable::CodonTable() {
     initializeCodonTable();
+    initializeLookup();
+}
+
+/**
+ * Map a base to its 2-bit code (U is treated as T), or -1 if invalid
+ */
+static int baseIndex(char base) {
+    switch (base) {
+        case 'T': case 'U': return 0;
+        case 'C': return 1;
+        case 'A': return 2;
+        case 'G': return 3;
+        default:  return -1;
+    }
+}
+
+/**
+ * Flatten the codon map into a 64-entry table indexed by 2-bit base codes
+ */
+void CodonTable::initializeLookup() {
+    for (const auto& entry : codon_table_) {
+        const std::string& codon = entry.first;
+        int index = baseIndex(codon[0]) * 16 + baseIndex(codon[1]) * 4 + baseIndex(codon[2]);
+        codon_lookup_[index] = entry.second;
+    }
 }
 
 /**
@@ -138,6 +163,20 @@ char CodonTable::translateCodon(const std::string& codon) const {
     return 'X';  // Unknown/invalid codon
 }
 
+/**
+ * Translate a codon given as three bases, without building a string.
+ * Returns 'X' if any base is invalid
+ */
+char CodonTable::translateCodon(char first, char second, char third) const {
+    int a = baseIndex(first);
+    int b = baseIndex(second);
+    int c = baseIndex(third);
+    if (a < 0 || b < 0 || c < 0) {
+        return 'X';
+    }
+    return codon_lookup_[a * 16 + b * 4 + c];
+}
+
 /**
  * Check if a codon exists in the table
  */
@@ -1,51 +1,247 @@
 #include "model/fasta_parser.h"
 #include <fstream>
 #include <iostream>
+#include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <thread>
 
-void FastaParser::parseHeader(const std::string& line,
-                              std::string& name,
-                              std::string& description) const {
-    std::string content = line.substr(1);
+// Below this a shard is not worth a thread of its own
+static const size_t MIN_SHARD_BYTES = 1 << 20;
+
+// Window size per shard when parseFile reads a whole file
+static const size_t FILE_WINDOW_BYTES = 8 << 20;
+
+/**
+ * First record header ('>' at the start of a line) at or after pos; pos
+ * itself counts as a line start when it equals begin
+ */
+static const char* nextRecordStart(const char* begin, const char* pos, const char* end) {
+    if (pos >= end) return end;
+
+    // Move to the start of the next line unless already at one
+    if (pos > begin && pos[-1] != '\n') {
+        pos = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+        if (!pos) return end;
+        pos++;
+    }
+
+    while (pos < end && *pos != '>') {
+        pos = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+        if (!pos) return end;
+        pos++;
+    }
+    return pos;
+}
+
+/**
+ * Last record header in (from, end), scanning backwards; nullptr if the
+ * range holds none. from must be past the first byte of the buffer.
+ */
+static const char* lastRecordStart(const char* from, const char* end) {
+    for (const char* pos = end; pos > from; ) {
+        pos--;
+        if (*pos == '>' && pos[-1] == '\n') return pos;
+    }
+    return nullptr;
+}
+
+// === INPUT ===
+
+FastaInput::FastaInput() : position_(0), streaming_(false) {}
+
+bool FastaInput::open(const std::string& filepath) {
+    buffer_.clear();
+    position_ = 0;
+    streaming_ = false;
+    if (mapped_.open(filepath))
+        return true;
+
+    // Directories can be opened as streams on some platforms, reject them here
+    std::error_code error;
+    if (std::filesystem::is_directory(filepath, error))
+        return false;
+
+    // Pipes and other streams cannot be mapped, read them a window at a time
+    stream_.open(filepath, std::ios::binary);
+    if (!stream_.is_open())
+        return false;
+    streaming_ = true;
+    return true;
+}
+
+// Append up to bytes from the stream; false once it has no more data
+bool FastaInput::readChunk(size_t bytes) {
+    size_t old = buffer_.size();
+    buffer_.resize(old + bytes);
+    stream_.read(&buffer_[old], static_cast<std::streamsize>(bytes));
+    size_t got = static_cast<size_t>(stream_.gcount());
+    buffer_.resize(old + got);
+    return got == bytes;
+}
+
+bool FastaInput::nextWindow(size_t windowBytes, const char*& begin, const char*& end) {
+    windowBytes = std::max<size_t>(windowBytes, 1);
+
+    if (!streaming_) {
+        const char* base = mapped_.data();
+        const char* fileEnd = base + mapped_.size();
+        if (position_ >= mapped_.size()) return false;
+
+        const char* window = base + position_;
+        size_t span = std::min(windowBytes, mapped_.size() - position_);
+        begin = window;
+        end = nextRecordStart(base, window + span, fileEnd);
+        position_ = static_cast<size_t>(end - base);
+        return true;
+    }
+
+    // Drop the window handed out last time, keeping the carried-over record
+    buffer_.erase(0, position_);
+    position_ = 0;
+
+    size_t scanned = 1;
+    for (;;) {
+        bool more = readChunk(windowBytes);
+        if (buffer_.empty()) return false;
+
+        const char* data = buffer_.data();
+        const char* split = more
+            ? lastRecordStart(data + scanned, data + buffer_.size())
+            : data + buffer_.size();
+        if (split) {
+            begin = data;
+            end = split;
+            position_ = static_cast<size_t>(split - data);
+            return true;
+        }
+        // A single record longer than everything read so far, keep reading
+        scanned = buffer_.size();
+    }
+}
+
+// === PARSER ===
+
+void FastaParser::parseHeader(std::string_view line,
+                              std::string_view& name,
+                              std::string_view& description) const {
+    std::string_view content = line.substr(1);
     size_t pos = content.find_first_of(" \t");
-    if (pos == std::string::npos) {
+    if (pos == std::string_view::npos) {
         name = content;
-        description = "";
+        description = std::string_view();
     } else {
         name = content.substr(0, pos);
         description = content.substr(pos + 1);
     }
 }
 
-std::vector<Sequence> FastaParser::parseFile(const std::string& filepath) const {
-    std::vector<Sequence> sequences;
-    std::ifstream file(filepath);
+void FastaParser::emitRecord(std::string_view name, std::string_view description,
+                             FastaShard& shard) const {
+    FastaRecord record;
+    record.name = name;
+    record.description = description;
+    record.dna = shard.batch.arena.copy(shard.dna);
+    shard.batch.records.push_back(record);
+    shard.dna.clear();
+}
 
-    if (!file.is_open()) {
-        std::cerr << "Error: cannot open file '" << filepath << "'\n";
-        return sequences;
-    }
+void FastaParser::parseRange(const char* begin, const char* end, FastaShard& shard) const {
+    shard.batch.clear();
+    shard.dna.clear();
+
+    std::string_view name;
+    std::string_view description;
+    const char* pos = begin;
 
-    std::string line, name, desc, dna;
+    while (pos < end) {
+        const char* newline = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+        const char* next = newline ? newline + 1 : end;
+        size_t length = (newline ? newline : end) - pos;
+        if (length > 0 && pos[length - 1] == '\r') length--;
+
+        std::string_view line(pos, length);
+        pos = next;
 
-    while (std::getline(file, line)) {
         if (line.empty() || line[0] == ';') continue;
-        if (!line.empty() && line.back() == '\r') line.pop_back();
 
         if (line[0] == '>') {
-            if (!dna.empty())
-                sequences.emplace_back(dna, name, desc);
-            parseHeader(line, name, desc);
-            dna.clear();
+            if (!shard.dna.empty())
+                emitRecord(name, description, shard);
+            parseHeader(line, name, description);
+        } else if (line.find_first_of(" \t\r\v\f") == std::string_view::npos) {
+            shard.dna.append(line.data(), line.size());
         } else {
             for (char c : line)
                 if (!std::isspace(static_cast<unsigned char>(c)))
-                    dna += c;
+                    shard.dna += c;
         }
     }
 
-    if (!dna.empty())
-        sequences.emplace_back(dna, name, desc);
+    if (!shard.dna.empty())
+        emitRecord(name, description, shard);
+}
+
+void FastaParser::parseSharded(const char* begin, const char* end,
+                               std::vector<FastaShard>& shards) const {
+    if (shards.empty()) return;
+
+    size_t bytes = static_cast<size_t>(end - begin);
+    size_t count = std::min(shards.size(), std::max<size_t>(1, bytes / MIN_SHARD_BYTES));
+
+    // Small ranges are parsed inline without splitting, threads or allocation
+    if (count == 1) {
+        parseRange(begin, end, shards[0]);
+        for (size_t k = 1; k < shards.size(); k++)
+            shards[k].batch.clear();
+        return;
+    }
+
+    // Snap each nominal split point forward to the next record header
+    std::vector<const char*> bounds(count + 1);
+    bounds[0] = begin;
+    bounds[count] = end;
+    for (size_t k = 1; k < count; k++) {
+        const char* split = nextRecordStart(begin, begin + bytes * k / count, end);
+        bounds[k] = std::max(split, bounds[k - 1]);
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(count - 1);
+    for (size_t k = 1; k < count; k++)
+        workers.emplace_back([this, &bounds, &shards, k] {
+            parseRange(bounds[k], bounds[k + 1], shards[k]);
+        });
+
+    parseRange(bounds[0], bounds[1], shards[0]);
+    for (std::thread& worker : workers)
+        worker.join();
+
+    for (size_t k = count; k < shards.size(); k++)
+        shards[k].batch.clear();
+}
+
+std::vector<Sequence> FastaParser::parseFile(const std::string& filepath) const {
+    std::vector<Sequence> sequences;
+    FastaInput input;
+
+    if (!input.open(filepath)) {
+        std::cerr << "Error: cannot open file '" << filepath << "'\n";
+        return sequences;
+    }
+
+    std::vector<FastaShard> shards(std::max(1u, std::thread::hardware_concurrency()));
+    const char* begin;
+    const char* end;
+    while (input.nextWindow(FILE_WINDOW_BYTES * shards.size(), begin, end)) {
+        parseSharded(begin, end, shards);
+        for (const FastaShard& shard : shards)
+            for (const FastaRecord& record : shard.batch.records)
+                sequences.emplace_back(std::string(record.dna),
+                                       std::string(record.name),
+                                       std::string(record.description));
+    }
 
     if (sequences.empty())
         std::cerr << "Warning: no sequences found in '" << filepath << "'\n";
@@ -0,0 +1,173 @@
+#include "model/motif_scanner.h"
+#include <fstream>
+#include <iostream>
+#include <cctype>
+
+MotifScanner::MotifScanner() {
+    build();
+}
+
+/**
+ * Add a single motif and recompile the automaton so step() and collect()
+ * always see a consistent DFA. Use loadFile() for bulk loading.
+ */
+bool MotifScanner::addMotif(const std::string& motif) {
+    if (!appendMotif(motif)) return false;
+    build();
+    return true;
+}
+
+bool MotifScanner::appendMotif(const std::string& motif) {
+    std::string cleaned;
+    for (char c : motif) {
+        if (std::isspace(static_cast<unsigned char>(c))) continue;
+        char upper = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        if (upper < 'A' || upper > 'Z') return false;
+        cleaned += upper;
+    }
+    if (cleaned.empty()) return false;
+
+    motifs_.push_back(cleaned);
+    return true;
+}
+
+/**
+ * Read one motif per line; blank lines and lines starting with '#' or
+ * ';' are skipped
+ */
+bool MotifScanner::loadFile(const std::string& filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        std::cerr << "Error: cannot open motif file '" << filepath << "'\n";
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        size_t first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line[first] == '#' || line[first] == ';')
+            continue;
+        if (!appendMotif(line)) {
+            std::cerr << "Warning: skipping invalid motif on line " << lineNumber
+                      << " of '" << filepath << "'\n";
+        }
+    }
+
+    if (motifs_.empty()) {
+        std::cerr << "Error: no motifs found in '" << filepath << "'\n";
+        return false;
+    }
+
+    build();
+    return true;
+}
+
+/**
+ * Compile the motifs into a DFA: build the trie, then fill in every
+ * missing transition from the failure links in BFS order so scanning
+ * never has to follow a failure chain. Outputs of each state include
+ * those of its failure state and are stored contiguously per state.
+ */
+void MotifScanner::build() {
+    transitions_.assign(ALPHABET, -1);
+    std::vector<std::vector<int>> own(1);
+
+    for (size_t m = 0; m < motifs_.size(); m++) {
+        int state = 0;
+        for (char c : motifs_[m]) {
+            int sym = c - 'A';
+            int& next = transitions_[state * ALPHABET + sym];
+            if (next == -1) {
+                next = static_cast<int>(own.size());
+                own.emplace_back();
+                transitions_.resize(transitions_.size() + ALPHABET, -1);
+            }
+            state = transitions_[state * ALPHABET + sym];
+        }
+        own[state].push_back(static_cast<int>(m));
+    }
+
+    int states = static_cast<int>(own.size());
+    std::vector<int> fail(states, 0);
+    std::vector<int> order;
+    order.reserve(states);
+    order.push_back(0);
+
+    for (int sym = 0; sym < ALPHABET; sym++) {
+        int& next = transitions_[sym];
+        if (next == -1) {
+            next = 0;
+        } else {
+            fail[next] = 0;
+            order.push_back(next);
+        }
+    }
+
+    for (size_t head = 1; head < order.size(); head++) {
+        int state = order[head];
+        for (int sym = 0; sym < ALPHABET; sym++) {
+            int& next = transitions_[state * ALPHABET + sym];
+            int fallback = transitions_[fail[state] * ALPHABET + sym];
+            if (next == -1) {
+                next = fallback;
+            } else {
+                fail[next] = fallback;
+                order.push_back(next);
+            }
+        }
+    }
+
+    // Flatten outputs, parents in BFS order are always finished first
+    std::vector<std::vector<int>> outputs(states);
+    for (int state : order) {
+        outputs[state] = own[state];
+        if (state != 0) {
+            const std::vector<int>& inherited = outputs[fail[state]];
+            outputs[state].insert(outputs[state].end(), inherited.begin(), inherited.end());
+        }
+    }
+
+    outputOffsets_.assign(states + 1, 0);
+    outputMotifs_.clear();
+    for (int s = 0; s < states; s++) {
+        outputOffsets_[s] = static_cast<int>(outputMotifs_.size());
+        outputMotifs_.insert(outputMotifs_.end(), outputs[s].begin(), outputs[s].end());
+    }
+    outputOffsets_[states] = static_cast<int>(outputMotifs_.size());
+}
+
+int MotifScanner::initialState() const {
+    return 0;
+}
+
+/**
+ * Advance the automaton by one residue. Anything outside A-Z (e.g. '*')
+ * cannot be part of a motif and resets to the root.
+ */
+int MotifScanner::step(int state, char aminoAcid) const {
+    int sym = aminoAcid - 'A';
+    if (sym < 0 || sym >= ALPHABET) return 0;
+    return transitions_[state * ALPHABET + sym];
+}
+
+/**
+ * Record every motif ending at the residue with 0-based index position
+ */
+void MotifScanner::collect(int state, int position, std::vector<MotifMatch>& matches) const {
+    for (int k = outputOffsets_[state]; k < outputOffsets_[state + 1]; k++) {
+        int motif = outputMotifs_[k];
+        int length = static_cast<int>(motifs_[motif].size());
+        matches.push_back({motif, position - length + 2});
+    }
+}
+
+const std::string& MotifScanner::getMotif(int index) const {
+    return motifs_[index];
+}
+
+bool MotifScanner::empty() const {
+    return motifs_.empty();
+}
@@ -0,0 +1,359 @@
+#include "model/protein_aligner.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <cctype>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ALIGNER_USE_SSE2 1
+#endif
+
+static const int32_t NEG_INF = INT32_MIN / 4;
+
+// Traceback flags, one byte per DP cell
+static const uint8_t FROM_DIAG = 0;
+static const uint8_t FROM_LEFT = 1;      // H came from E (gap in query)
+static const uint8_t FROM_UP = 2;        // H came from F (gap in reference)
+static const uint8_t FROM_START = 3;     // local alignment starts here
+static const uint8_t SOURCE_MASK = 3;
+static const uint8_t LEFT_EXTENDED = 4;  // E extended an existing gap
+static const uint8_t UP_EXTENDED = 8;    // F extended an existing gap
+
+static const char BLOSUM_SYMBOLS[] = "ARNDCQEGHILKMFPSTWYVBZX*";
+static const int BLOSUM_SIZE = 24;
+static const int UNKNOWN_SYMBOL = 22;    // 'X'
+
+static const int8_t BLOSUM62[BLOSUM_SIZE][BLOSUM_SIZE] = {
+    // A   R   N   D   C   Q   E   G   H   I   L   K   M   F   P   S   T   W   Y   V   B   Z   X   *
+    {  4, -1, -2, -2,  0, -1, -1,  0, -2, -1, -1, -1, -1, -2, -1,  1,  0, -3, -2,  0, -2, -1,  0, -4 },  // A
+    { -1,  5,  0, -2, -3,  1,  0, -2,  0, -3, -2,  2, -1, -3, -2, -1, -1, -3, -2, -3, -1,  0, -1, -4 },  // R
+    { -2,  0,  6,  1, -3,  0,  0,  0,  1, -3, -3,  0, -2, -3, -2,  1,  0, -4, -2, -3,  3,  0, -1, -4 },  // N
+    { -2, -2,  1,  6, -3,  0,  2, -1, -1, -3, -4, -1, -3, -3, -1,  0, -1, -4, -3, -3,  4,  1, -1, -4 },  // D
+    {  0, -3, -3, -3,  9, -3, -4, -3, -3, -1, -1, -3, -1, -2, -3, -1, -1, -2, -2, -1, -3, -3, -2, -4 },  // C
+    { -1,  1,  0,  0, -3,  5,  2, -2,  0, -3, -2,  1,  0, -3, -1,  0, -1, -2, -1, -2,  0,  3, -1, -4 },  // Q
+    { -1,  0,  0,  2, -4,  2,  5, -2,  0, -3, -3,  1, -2, -3, -1,  0, -1, -3, -2, -2,  1,  4, -1, -4 },  // E
+    {  0, -2,  0, -1, -3, -2, -2,  6, -2, -4, -4, -2, -3, -3, -2,  0, -2, -2, -3, -3, -1, -2, -1, -4 },  // G
+    { -2,  0,  1, -1, -3,  0,  0, -2,  8, -3, -3, -1, -2, -1, -2, -1, -2, -2,  2, -3,  0,  0, -1, -4 },  // H
+    { -1, -3, -3, -3, -1, -3, -3, -4, -3,  4,  2, -3,  1,  0, -3, -2, -1, -3, -1,  3, -3, -3, -1, -4 },  // I
+    { -1, -2, -3, -4, -1, -2, -3, -4, -3,  2,  4, -2,  2,  0, -3, -2, -1, -2, -1,  1, -4, -3, -1, -4 },  // L
+    { -1,  2,  0, -1, -3,  1,  1, -2, -1, -3, -2,  5, -1, -3, -1,  0, -1, -3, -2, -2,  0,  1, -1, -4 },  // K
+    { -1, -1, -2, -3, -1,  0, -2, -3, -2,  1,  2, -1,  5,  0, -2, -1, -1, -1, -1,  1, -3, -1, -1, -4 },  // M
+    { -2, -3, -3, -3, -2, -3, -3, -3, -1,  0,  0, -3,  0,  6, -4, -2, -2,  1,  3, -1, -3, -3, -1, -4 },  // F
+    { -1, -2, -2, -1, -3, -1, -1, -2, -2, -3, -3, -1, -2, -4,  7, -1, -1, -4, -3, -2, -2, -1, -2, -4 },  // P
+    {  1, -1,  1,  0, -1,  0,  0,  0, -1, -2, -2,  0, -1, -2, -1,  4,  1, -3, -2, -2,  0,  0,  0, -4 },  // S
+    {  0, -1,  0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, -2, -1,  1,  5, -2, -2,  0, -1, -1,  0, -4 },  // T
+    { -3, -3, -4, -4, -2, -2, -3, -2, -2, -3, -2, -3, -1,  1, -4, -3, -2, 11,  2, -3, -4, -3, -2, -4 },  // W
+    { -2, -2, -2, -3, -2, -1, -2, -3,  2, -1, -1, -2, -1,  3, -3, -2, -2,  2,  7, -1, -3, -2, -1, -4 },  // Y
+    {  0, -3, -3, -3, -1, -2, -2, -3, -3,  3,  1, -2,  1, -1, -2, -2,  0, -3, -1,  4, -3, -2, -1, -4 },  // V
+    { -2, -1,  3,  4, -3,  0,  1, -1,  0, -3, -4,  0, -3, -3, -2,  0, -1, -4, -3, -3,  4,  1, -1, -4 },  // B
+    { -1,  0,  0,  1, -3,  3,  4, -2,  0, -3, -3,  1, -1, -3, -1,  0, -1, -3, -2, -2,  1,  4, -1, -4 },  // Z
+    {  0, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2,  0,  0, -2, -1, -1, -1, -1, -1, -4 },  // X
+    { -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,  1 },  // *
+};
+
+static int symbolIndex(char residue) {
+    char upper = static_cast<char>(std::toupper(static_cast<unsigned char>(residue)));
+    const char* found = std::strchr(BLOSUM_SYMBOLS, upper);
+    if (upper == '\0' || found == nullptr) return UNKNOWN_SYMBOL;
+    return static_cast<int>(found - BLOSUM_SYMBOLS);
+}
+
+// Floor/ceil division by 2 that also behaves for negative numerators
+static int floorHalf(int x) { return x >= 0 ? x / 2 : -((-x + 1) / 2); }
+static int ceilHalf(int x) { return x >= 0 ? (x + 1) / 2 : -((-x) / 2); }
+
+ProteinAligner::ProteinAligner() {
+    initializeMatrix();
+}
+
+void ProteinAligner::initializeMatrix() {
+    for (int a = 0; a < 26; a++) {
+        for (int b = 0; b < 26; b++) {
+            int ia = symbolIndex(static_cast<char>('A' + a));
+            int ib = symbolIndex(static_cast<char>('A' + b));
+            blosum_[a][b] = BLOSUM62[ia][ib];
+        }
+    }
+}
+
+int ProteinAligner::substitutionScore(char a, char b) {
+    return BLOSUM62[symbolIndex(a)][symbolIndex(b)];
+}
+
+PairwiseAlignment ProteinAligner::align(const std::string& query,
+                                        const std::string& reference,
+                                        const AlignmentOptions& options) const {
+    PairwiseAlignment result;
+    AlignmentScratch scratch;
+    align(query, reference, options, result, scratch);
+    return result;
+}
+
+void ProteinAligner::align(const std::string& query,
+                           const std::string& reference,
+                           const AlignmentOptions& options,
+                           PairwiseAlignment& result,
+                           AlignmentScratch& scratch) const {
+    result.alignedQuery.clear();
+    result.alignedReference.clear();
+    result.identities = 0;
+    result.positives = 0;
+    result.gaps = 0;
+    const int m = static_cast<int>(query.size());
+    const int n = static_cast<int>(reference.size());
+    const bool local = options.mode == AlignmentMode::Local;
+    const int32_t gapOpenExtend = options.gapOpen + options.gapExtend;
+    const int32_t gapExtend = options.gapExtend;
+
+    // Band as a range of allowed (i - j); it always covers both corners
+    int diffLow = -n;
+    int diffHigh = m;
+    if (options.band >= 0) {
+        int band = std::max(options.band, 1);
+        diffLow = std::max(diffLow, std::min(0, m - n) - band);
+        diffHigh = std::min(diffHigh, std::max(0, m - n) + band);
+    }
+
+    const int diagonals = m + n + 1;
+    std::vector<int>& diagLow = scratch.diagLow;
+    std::vector<size_t>& diagOffset = scratch.diagOffset;
+    diagLow.resize(diagonals);
+    diagOffset.assign(diagonals + 1, 0);
+    for (int d = 0; d < diagonals; d++) {
+        int low = std::max(std::max(0, d - n), ceilHalf(d + diffLow));
+        int high = std::min(std::min(m, d), floorHalf(d + diffHigh));
+        diagLow[d] = low;
+        diagOffset[d + 1] = diagOffset[d] + static_cast<size_t>(std::max(0, high - low + 1));
+    }
+    std::vector<uint8_t>& trace = scratch.trace;
+    trace.resize(diagOffset[diagonals]);
+
+    // Residues as BLOSUM row indices; the reference is reversed so that
+    // reference[d - i - 1] is contiguous in i along a diagonal
+    std::vector<uint8_t>& queryCodes = scratch.queryCodes;
+    std::vector<uint8_t>& reversedRef = scratch.reversedRef;
+    queryCodes.assign(m + 1, 0);
+    reversedRef.assign(n, 0);
+    for (int i = 0; i < m; i++) {
+        int c = std::toupper(static_cast<unsigned char>(query[i])) - 'A';
+        queryCodes[i + 1] = static_cast<uint8_t>(c >= 0 && c < 26 ? c : 'X' - 'A');
+    }
+    for (int j = 0; j < n; j++) {
+        int c = std::toupper(static_cast<unsigned char>(reference[n - 1 - j])) - 'A';
+        reversedRef[j] = static_cast<uint8_t>(c >= 0 && c < 26 ? c : 'X' - 'A');
+    }
+
+    std::vector<int32_t>* hBuf = scratch.h;
+    std::vector<int32_t>* eBuf = scratch.e;
+    std::vector<int32_t>* fBuf = scratch.f;
+    for (int k = 0; k < 3; k++) hBuf[k].assign(m + 2, NEG_INF);
+    for (int k = 0; k < 2; k++) eBuf[k].assign(m + 2, NEG_INF);
+    for (int k = 0; k < 2; k++) fBuf[k].assign(m + 2, NEG_INF);
+    std::vector<int32_t>& scores = scratch.scores;
+    scores.assign(m + 1, 0);
+
+    int32_t best = 0;
+    int bestI = 0;
+    int bestJ = 0;
+
+    for (int d = 0; d < diagonals; d++) {
+        int low = diagLow[d];
+        int high = low + static_cast<int>(diagOffset[d + 1] - diagOffset[d]) - 1;
+        if (high < low) continue;
+
+        int32_t* hCur = hBuf[d % 3].data();
+        const int32_t* hPrev = hBuf[(d + 2) % 3].data();
+        const int32_t* hPrev2 = hBuf[(d + 1) % 3].data();
+        int32_t* eCur = eBuf[d % 2].data();
+        const int32_t* ePrev = eBuf[(d + 1) % 2].data();
+        int32_t* fCur = fBuf[d % 2].data();
+        const int32_t* fPrev = fBuf[(d + 1) % 2].data();
+        uint8_t* traceRow = trace.data() + diagOffset[d];
+
+        // Boundary cells on the first row (i = 0) and first column (j = 0)
+        if (low == 0) {
+            hCur[0] = (local || d == 0) ? 0 : -(options.gapOpen + d * gapExtend);
+            eCur[0] = (local || d == 0) ? NEG_INF : hCur[0];
+            fCur[0] = NEG_INF;
+            traceRow[0] = FROM_START;
+        }
+        if (high == d && d > 0) {
+            hCur[d] = local ? 0 : -(options.gapOpen + d * gapExtend);
+            eCur[d] = NEG_INF;
+            fCur[d] = local ? NEG_INF : hCur[d];
+            traceRow[d - low] = FROM_START;
+        }
+
+        int first = std::max(low, 1);
+        int last = std::min(high, d - 1);
+
+        // Cell (i, d - i) pairs query[i] with reversedRef[n - d + i]
+        for (int i = first; i <= last; i++)
+            scores[i] = blosum_[queryCodes[i]][reversedRef[n - d + i]];
+
+        int i = first;
+#ifdef ALIGNER_USE_SSE2
+        const __m128i vOpen = _mm_set1_epi32(gapOpenExtend);
+        const __m128i vExtend = _mm_set1_epi32(gapExtend);
+        const __m128i vLeft = _mm_set1_epi32(FROM_LEFT);
+        const __m128i vUp = _mm_set1_epi32(FROM_UP);
+        const __m128i vStart = _mm_set1_epi32(FROM_START);
+        const __m128i vLeftExt = _mm_set1_epi32(LEFT_EXTENDED);
+        const __m128i vUpExt = _mm_set1_epi32(UP_EXTENDED);
+        const __m128i vZero = _mm_setzero_si128();
+
+        for (; i + 3 <= last; i += 4) {
+            __m128i hLeft = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hPrev + i));
+            __m128i eLeft = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ePrev + i));
+            __m128i hUp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hPrev + i - 1));
+            __m128i fUp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fPrev + i - 1));
+            __m128i hDiag = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hPrev2 + i - 1));
+            __m128i sub = _mm_loadu_si128(reinterpret_cast<const __m128i*>(scores.data() + i));
+
+            __m128i eOpen = _mm_sub_epi32(hLeft, vOpen);
+            __m128i eExt = _mm_sub_epi32(eLeft, vExtend);
+            __m128i eExtended = _mm_cmpgt_epi32(eExt, eOpen);
+            __m128i e = _mm_or_si128(_mm_and_si128(eExtended, eExt),
+                                     _mm_andnot_si128(eExtended, eOpen));
+
+            __m128i fOpen = _mm_sub_epi32(hUp, vOpen);
+            __m128i fExt = _mm_sub_epi32(fUp, vExtend);
+            __m128i fExtended = _mm_cmpgt_epi32(fExt, fOpen);
+            __m128i f = _mm_or_si128(_mm_and_si128(fExtended, fExt),
+                                     _mm_andnot_si128(fExtended, fOpen));
+
+            __m128i h = _mm_add_epi32(hDiag, sub);
+            __m128i source = vZero;
+
+            __m128i takeE = _mm_cmpgt_epi32(e, h);
+            h = _mm_or_si128(_mm_and_si128(takeE, e), _mm_andnot_si128(takeE, h));
+            source = _mm_or_si128(_mm_and_si128(takeE, vLeft), _mm_andnot_si128(takeE, source));
+
+            __m128i takeF = _mm_cmpgt_epi32(f, h);
+            h = _mm_or_si128(_mm_and_si128(takeF, f), _mm_andnot_si128(takeF, h));
+            source = _mm_or_si128(_mm_and_si128(takeF, vUp), _mm_andnot_si128(takeF, source));
+
+            if (local) {
+                __m128i positive = _mm_cmpgt_epi32(h, vZero);
+                h = _mm_and_si128(positive, h);
+                source = _mm_or_si128(_mm_and_si128(positive, source),
+                                      _mm_andnot_si128(positive, vStart));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(hCur + i), h);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(eCur + i), e);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(fCur + i), f);
+
+            __m128i flags = _mm_or_si128(source,
+                            _mm_or_si128(_mm_and_si128(eExtended, vLeftExt),
+                                         _mm_and_si128(fExtended, vUpExt)));
+            __m128i packed = _mm_packs_epi32(flags, flags);
+            packed = _mm_packus_epi16(packed, packed);
+            int32_t bytes = _mm_cvtsi128_si32(packed);
+            std::memcpy(traceRow + (i - low), &bytes, sizeof(bytes));
+        }
+#endif
+        for (; i <= last; i++) {
+            int32_t eOpen = hPrev[i] - gapOpenExtend;
+            int32_t eExt = ePrev[i] - gapExtend;
+            int32_t fOpen = hPrev[i - 1] - gapOpenExtend;
+            int32_t fExt = fPrev[i - 1] - gapExtend;
+            int32_t e = std::max(eOpen, eExt);
+            int32_t f = std::max(fOpen, fExt);
+
+            int32_t h = hPrev2[i - 1] + scores[i];
+            uint8_t source = FROM_DIAG;
+            if (e > h) { h = e; source = FROM_LEFT; }
+            if (f > h) { h = f; source = FROM_UP; }
+            if (local && h <= 0) { h = 0; source = FROM_START; }
+
+            hCur[i] = h;
+            eCur[i] = e;
+            fCur[i] = f;
+            traceRow[i - low] = static_cast<uint8_t>(source
+                | (eExt > eOpen ? LEFT_EXTENDED : 0)
+                | (fExt > fOpen ? UP_EXTENDED : 0));
+        }
+
+        // Cells just outside the band must read as unreachable
+        if (low > 0) {
+            hCur[low - 1] = eCur[low - 1] = fCur[low - 1] = NEG_INF;
+        }
+        if (high < m) {
+            hCur[high + 1] = eCur[high + 1] = fCur[high + 1] = NEG_INF;
+        }
+
+        if (local) {
+            for (int k = first; k <= last; k++) {
+                if (hCur[k] > best) {
+                    best = hCur[k];
+                    bestI = k;
+                    bestJ = d - k;
+                }
+            }
+        }
+    }
+
+    int i = local ? bestI : m;
+    int j = local ? bestJ : n;
+    result.score = local ? best : hBuf[(m + n) % 3][m];
+    result.queryEnd = i;
+    result.referenceEnd = j;
+
+    // Traceback; state 0 = H, 1 = E (gap in query), 2 = F (gap in reference)
+    int state = 0;
+    while (i > 0 || j > 0) {
+        if (i == 0 || j == 0) {
+            if (local) break;
+            if (i == 0) {
+                result.alignedQuery += '-';
+                result.alignedReference += reference[--j];
+            } else {
+                result.alignedQuery += query[--i];
+                result.alignedReference += '-';
+            }
+            continue;
+        }
+
+        int d = i + j;
+        uint8_t flags = trace[diagOffset[d] + (i - diagLow[d])];
+
+        if (state == 0) {
+            uint8_t source = flags & SOURCE_MASK;
+            if (source == FROM_START) break;
+            if (source == FROM_DIAG) {
+                result.alignedQuery += query[--i];
+                result.alignedReference += reference[--j];
+            } else {
+                state = source == FROM_LEFT ? 1 : 2;
+            }
+        } else if (state == 1) {
+            result.alignedQuery += '-';
+            result.alignedReference += reference[--j];
+            state = (flags & LEFT_EXTENDED) ? 1 : 0;
+        } else {
+            result.alignedQuery += query[--i];
+            result.alignedReference += '-';
+            state = (flags & UP_EXTENDED) ? 2 : 0;
+        }
+    }
+
+    std::reverse(result.alignedQuery.begin(), result.alignedQuery.end());
+    std::reverse(result.alignedReference.begin(), result.alignedReference.end());
+    result.queryStart = result.alignedQuery.empty() ? 0 : i + 1;
+    result.referenceStart = result.alignedReference.empty() ? 0 : j + 1;
+
+    for (size_t k = 0; k < result.alignedQuery.size(); k++) {
+        char a = result.alignedQuery[k];
+        char b = result.alignedReference[k];
+        if (a == '-' || b == '-') {
+            result.gaps++;
+        } else {
+            if (std::toupper(static_cast<unsigned char>(a)) == std::toupper(static_cast<unsigned char>(b)))
+                result.identities++;
+            if (substitutionScore(a, b) > 0)
+                result.positives++;
+        }
+    }
+}
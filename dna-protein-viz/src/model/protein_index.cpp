@@ -0,0 +1,238 @@
+#include "model/protein_index.h"
+#include "model/suffix_array.h"
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <limits>
+
+static const char INDEX_MAGIC[8] = {'P', 'R', 'O', 'T', 'I', 'D', 'X', '1'};
+static const char PROTEIN_SEPARATOR = '#';
+
+static uint64_t alignUp(uint64_t offset) {
+    return (offset + 7) & ~static_cast<uint64_t>(7);
+}
+
+static void writePadding(std::ofstream& out, uint64_t written) {
+    static const char zeros[8] = {};
+    out.write(zeros, static_cast<std::streamsize>(alignUp(written) - written));
+}
+
+// === WRITER ===
+
+ProteinIndexWriter::ProteinIndexWriter() : residues_(0) {}
+
+bool ProteinIndexWriter::addProtein(const std::string& name, int frame,
+                                    const std::string& protein) {
+    // Offsets are stored as int32 in the suffix array
+    if (text_.size() + protein.size() + 1 >
+        static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        std::cerr << "Error: proteome too large for index (over 2 GB of residues)\n";
+        return false;
+    }
+
+    IndexEntry entry;
+    entry.textStart = static_cast<uint32_t>(text_.size());
+    entry.length = static_cast<uint32_t>(protein.size());
+    entry.nameOffset = static_cast<uint32_t>(names_.size());
+    entry.frame = frame;
+    entries_.push_back(entry);
+
+    names_ += name;
+    names_ += '\0';
+    text_ += protein;
+    text_ += PROTEIN_SEPARATOR;
+    residues_ += protein.size();
+    return true;
+}
+
+bool ProteinIndexWriter::write(const std::string& filepath) const {
+    std::vector<int32_t> sa = SuffixArray::build(text_);
+    std::vector<int32_t> lcp = SuffixArray::buildLCP(text_, sa);
+
+    std::ofstream out(filepath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Error: cannot write index '" << filepath << "'\n";
+        return false;
+    }
+
+    IndexHeader header = {};
+    std::memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+    header.entryCount = static_cast<uint32_t>(entries_.size());
+    header.namesBytes = names_.size();
+    header.textBytes = text_.size();
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries_.data()),
+              static_cast<std::streamsize>(entries_.size() * sizeof(IndexEntry)));
+    out.write(names_.data(), static_cast<std::streamsize>(names_.size()));
+    writePadding(out, names_.size());
+    out.write(text_.data(), static_cast<std::streamsize>(text_.size()));
+    writePadding(out, text_.size());
+    out.write(reinterpret_cast<const char*>(sa.data()),
+              static_cast<std::streamsize>(sa.size() * sizeof(int32_t)));
+    writePadding(out, sa.size() * sizeof(int32_t));
+    out.write(reinterpret_cast<const char*>(lcp.data()),
+              static_cast<std::streamsize>(lcp.size() * sizeof(int32_t)));
+
+    if (!out) {
+        std::cerr << "Error: failed while writing index '" << filepath << "'\n";
+        return false;
+    }
+    return true;
+}
+
+size_t ProteinIndexWriter::getProteinCount() const {
+    return entries_.size();
+}
+
+size_t ProteinIndexWriter::getResidueCount() const {
+    return residues_;
+}
+
+// === READER ===
+
+ProteinIndex::ProteinIndex()
+    : entries_(nullptr), names_(nullptr), text_(nullptr), sa_(nullptr), lcp_(nullptr),
+      entryCount_(0), namesBytes_(0), textBytes_(0) {}
+
+bool ProteinIndex::load(const std::string& filepath) {
+    if (!file_.open(filepath)) {
+        std::cerr << "Error: cannot open index '" << filepath << "'\n";
+        return false;
+    }
+
+    IndexHeader header;
+    if (file_.size() < sizeof(header)) {
+        std::cerr << "Error: '" << filepath << "' is not a protein index\n";
+        return false;
+    }
+    std::memcpy(&header, file_.data(), sizeof(header));
+    if (std::memcmp(header.magic, INDEX_MAGIC, sizeof(header.magic)) != 0) {
+        std::cerr << "Error: '" << filepath << "' is not a protein index\n";
+        return false;
+    }
+
+    // Offsets are int32 in the suffix array, and neither section can be
+    // larger than the file; checked first so the layout math cannot overflow
+    if (header.textBytes > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ||
+        header.namesBytes > file_.size()) {
+        std::cerr << "Error: index '" << filepath << "' is corrupt\n";
+        return false;
+    }
+
+    uint64_t entriesAt = sizeof(IndexHeader);
+    uint64_t namesAt = entriesAt + uint64_t(header.entryCount) * sizeof(IndexEntry);
+    uint64_t textAt = alignUp(namesAt + header.namesBytes);
+    uint64_t saAt = alignUp(textAt + header.textBytes);
+    uint64_t lcpAt = alignUp(saAt + header.textBytes * sizeof(int32_t));
+    uint64_t end = lcpAt + header.textBytes * sizeof(int32_t);
+
+    if (end > file_.size()) {
+        std::cerr << "Error: index '" << filepath << "' is truncated\n";
+        return false;
+    }
+
+    const char* base = file_.data();
+    entries_ = reinterpret_cast<const IndexEntry*>(base + entriesAt);
+    names_ = base + namesAt;
+    entryCount_ = header.entryCount;
+    namesBytes_ = header.namesBytes;
+    textBytes_ = header.textBytes;
+
+    if (!validateEntries()) {
+        std::cerr << "Error: index '" << filepath << "' is corrupt\n";
+        entryCount_ = 0;
+        textBytes_ = 0;
+        return false;
+    }
+
+    text_ = base + textAt;
+    sa_ = reinterpret_cast<const int32_t*>(base + saAt);
+    lcp_ = reinterpret_cast<const int32_t*>(base + lcpAt);
+    return true;
+}
+
+/**
+ * Check every entry once so getName() and entryAt() can trust them: the
+ * proteins must tile the text exactly as the writer lays them out, and
+ * every name must start inside the NUL-terminated names section.
+ */
+bool ProteinIndex::validateEntries() const {
+    if (namesBytes_ > 0 && names_[namesBytes_ - 1] != '\0') return false;
+
+    uint64_t expectedStart = 0;
+    for (uint32_t i = 0; i < entryCount_; i++) {
+        const IndexEntry& entry = entries_[i];
+        if (entry.textStart != expectedStart) return false;
+        if (entry.nameOffset >= namesBytes_) return false;
+        expectedStart += uint64_t(entry.length) + 1;
+        if (expectedStart > textBytes_) return false;
+    }
+    return expectedStart == textBytes_;
+}
+
+/**
+ * Compare the suffix starting at text position suffix against the
+ * peptide, treating a suffix that starts with the peptide as equal
+ */
+int ProteinIndex::compareSuffix(int32_t suffix, const std::string& peptide) const {
+    // A corrupt suffix array must not send reads outside the text
+    if (suffix < 0 || static_cast<uint64_t>(suffix) >= textBytes_) return 1;
+
+    uint64_t available = textBytes_ - static_cast<uint64_t>(suffix);
+    size_t length = peptide.size() < available ? peptide.size() : static_cast<size_t>(available);
+
+    int cmp = std::memcmp(text_ + suffix, peptide.data(), length);
+    if (cmp != 0) return cmp;
+    return length < peptide.size() ? -1 : 0;
+}
+
+int ProteinIndex::entryAt(int32_t textPos) const {
+    uint32_t low = 0;
+    uint32_t high = entryCount_;
+    while (high - low > 1) {
+        uint32_t mid = low + (high - low) / 2;
+        if (entries_[mid].textStart <= static_cast<uint32_t>(textPos))
+            low = mid;
+        else
+            high = mid;
+    }
+    return static_cast<int>(low);
+}
+
+void ProteinIndex::find(const std::string& peptide, std::vector<IndexHit>& hits) const {
+    if (peptide.empty() || textBytes_ == 0) return;
+
+    // Lower bound: first suffix not less than the peptide
+    uint64_t low = 0;
+    uint64_t high = textBytes_;
+    while (low < high) {
+        uint64_t mid = low + (high - low) / 2;
+        if (compareSuffix(sa_[mid], peptide) < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low == textBytes_ || compareSuffix(sa_[low], peptide) != 0) return;
+
+    // Matching suffixes are contiguous; the LCP array tells where they end
+    int32_t m = static_cast<int32_t>(peptide.size());
+    for (uint64_t i = low; i < textBytes_; i++) {
+        if (i > low && lcp_[i] < m) break;
+        if (sa_[i] < 0 || static_cast<uint64_t>(sa_[i]) >= textBytes_) break;
+
+        int entry = entryAt(sa_[i]);
+        IndexHit hit;
+        hit.entry = entry;
+        hit.position = static_cast<int>(sa_[i] - static_cast<int32_t>(entries_[entry].textStart)) + 1;
+        hits.push_back(hit);
+    }
+}
+
+const char* ProteinIndex::getName(int entry) const {
+    return names_ + entries_[entry].nameOffset;
+}
+
+int ProteinIndex::getFrame(int entry) const {
+    return entries_[entry].frame;
+}
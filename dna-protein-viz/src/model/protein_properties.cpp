@@ -0,0 +1,122 @@
+#include "model/protein_properties.h"
+#include <cmath>
+
+static const double WATER_MASS = 18.01524;
+static const double NEUTRAL_PH = 7.0;
+static const double PI_TOLERANCE = 0.0001;
+
+// pKa values for ionizable groups (EMBOSS set)
+static const double PKA_N_TERM = 8.6;
+static const double PKA_C_TERM = 3.6;
+static const double PKA_LYS = 10.8;
+static const double PKA_ARG = 12.5;
+static const double PKA_HIS = 6.5;
+static const double PKA_ASP = 3.9;
+static const double PKA_GLU = 4.1;
+static const double PKA_CYS = 8.5;
+static const double PKA_TYR = 10.1;
+
+ProteinAnalyzer::ProteinAnalyzer() {
+    initializeTables();
+}
+
+/**
+ * Fill the flat per-residue lookup tables, indexed directly by the
+ * one-letter code so the hot loop needs no branching or map lookups
+ */
+void ProteinAnalyzer::initializeTables() {
+    for (int i = 0; i < 256; i++) {
+        residueMass_[i] = 0.0;
+        hydropathy_[i] = 0.0;
+        known_[i] = false;
+    }
+
+    struct Residue { char code; double mass; double hydropathy; };
+    static const Residue residues[] = {
+        {'A',  71.0788,  1.8}, {'R', 156.1875, -4.5}, {'N', 114.1038, -3.5},
+        {'D', 115.0886, -3.5}, {'C', 103.1388,  2.5}, {'E', 129.1155, -3.5},
+        {'Q', 128.1307, -3.5}, {'G',  57.0519, -0.4}, {'H', 137.1411, -3.2},
+        {'I', 113.1594,  4.5}, {'L', 113.1594,  3.8}, {'K', 128.1741, -3.9},
+        {'M', 131.1926,  1.9}, {'F', 147.1766,  2.8}, {'P',  97.1167, -1.6},
+        {'S',  87.0782, -0.8}, {'T', 101.1051, -0.7}, {'W', 186.2132, -0.9},
+        {'Y', 163.1760, -1.3}, {'V',  99.1326,  4.2},
+    };
+
+    for (const Residue& r : residues) {
+        unsigned char idx = static_cast<unsigned char>(r.code);
+        residueMass_[idx] = r.mass;
+        hydropathy_[idx] = r.hydropathy;
+        known_[idx] = true;
+    }
+}
+
+/**
+ * Net charge at a given pH (Henderson-Hasselbalch) from residue counts
+ */
+double ProteinAnalyzer::chargeAt(const ChargeCounts& c, double pH) const {
+    if (!c.hasTermini) return 0.0;
+
+    double positive = 1.0 / (1.0 + std::pow(10.0, pH - PKA_N_TERM))
+                    + c.lys / (1.0 + std::pow(10.0, pH - PKA_LYS))
+                    + c.arg / (1.0 + std::pow(10.0, pH - PKA_ARG))
+                    + c.his / (1.0 + std::pow(10.0, pH - PKA_HIS));
+
+    double negative = 1.0 / (1.0 + std::pow(10.0, PKA_C_TERM - pH))
+                    + c.asp / (1.0 + std::pow(10.0, PKA_ASP - pH))
+                    + c.glu / (1.0 + std::pow(10.0, PKA_GLU - pH))
+                    + c.cys / (1.0 + std::pow(10.0, PKA_CYS - pH))
+                    + c.tyr / (1.0 + std::pow(10.0, PKA_TYR - pH));
+
+    return positive - negative;
+}
+
+/**
+ * Bisect on pH until the net charge crosses zero. Charge is monotonically
+ * decreasing in pH, and the residue counts are computed once up front.
+ */
+double ProteinAnalyzer::solveIsoelectricPoint(const ChargeCounts& counts) const {
+    if (!counts.hasTermini) return 0.0;
+
+    double low = 0.0;
+    double high = 14.0;
+    while (high - low > PI_TOLERANCE) {
+        double mid = (low + high) / 2.0;
+        if (chargeAt(counts, mid) > 0.0)
+            low = mid;
+        else
+            high = mid;
+    }
+    return (low + high) / 2.0;
+}
+
+ProteinProperties ProteinAnalyzer::analyze(const std::string& protein) const {
+    int counts[256] = {};
+    double mass = 0.0;
+    double hydropathy = 0.0;
+    int knownResidues = 0;
+
+    for (char aa : protein) {
+        unsigned char idx = static_cast<unsigned char>(aa);
+        counts[idx]++;
+        mass += residueMass_[idx];
+        hydropathy += hydropathy_[idx];
+        knownResidues += known_[idx];
+    }
+
+    ChargeCounts charge;
+    charge.lys = counts['K'];
+    charge.arg = counts['R'];
+    charge.his = counts['H'];
+    charge.asp = counts['D'];
+    charge.glu = counts['E'];
+    charge.cys = counts['C'];
+    charge.tyr = counts['Y'];
+    charge.hasTermini = !protein.empty();
+
+    ProteinProperties props;
+    props.molecularWeight = knownResidues > 0 ? mass + WATER_MASS : 0.0;
+    props.gravy = knownResidues > 0 ? hydropathy / knownResidues : 0.0;
+    props.isoelectricPoint = solveIsoelectricPoint(charge);
+    props.netCharge = chargeAt(charge, NEUTRAL_PH);
+    return props;
+}
@@ -15,22 +15,22 @@ Sequence::Sequence()
 }
 
 // === GETTERS ===
-std::string Sequence::getDNA() const {
+const std::string& Sequence::getDNA() const {
     return dna_;
 }
 
 
-std::string Sequence::getProtein() const {
+const std::string& Sequence::getProtein() const {
     return protein_;
 }
 
 
-std::string Sequence::getName() const {
+const std::string& Sequence::getName() const {
     return name_;
 }
 
 
-std::string Sequence::getDescription() const {
+const std::string& Sequence::getDescription() const {
     return description_;
 }
 
@@ -49,13 +49,18 @@ void Sequence::setDNA(const std::string& dna) {
 
 
 bool Sequence::isValid() const {
+    return isValidDNA(dna_);
+}
+
+
+bool Sequence::isValidDNA(std::string_view dna) {
     // Empty sequence is invalid
-    if (dna_.empty()) {
+    if (dna.empty()) {
         return false;
     }
     
     // Check each character
-    for (char nucleotide : dna_) {
+    for (char nucleotide : dna) {
         // Convert to uppercase for comparison
         char upper = std::toupper(nucleotide);
         
@@ -0,0 +1,156 @@
+#include "model/suffix_array.h"
+#include <algorithm>
+
+static inline bool isLMS(const std::vector<char>& isS, int32_t i) {
+    return i > 0 && isS[i] && !isS[i - 1];
+}
+
+void SuffixArray::getBuckets(const int32_t* text, int32_t n, int32_t alphabet,
+                             std::vector<int32_t>& buckets, bool bucketEnds) {
+    std::fill(buckets.begin(), buckets.end(), 0);
+    for (int32_t i = 0; i < n; i++)
+        buckets[text[i]]++;
+
+    int32_t sum = 0;
+    for (int32_t c = 0; c < alphabet; c++) {
+        sum += buckets[c];
+        buckets[c] = bucketEnds ? sum : sum - buckets[c];
+    }
+}
+
+/**
+ * Induce L-type suffixes left to right from the seeded positions,
+ * then S-type suffixes right to left
+ */
+void SuffixArray::induceSort(const int32_t* text, int32_t* sa, int32_t n, int32_t alphabet,
+                             const std::vector<char>& isS, std::vector<int32_t>& buckets) {
+    getBuckets(text, n, alphabet, buckets, false);
+    for (int32_t i = 0; i < n; i++) {
+        int32_t j = sa[i] - 1;
+        if (sa[i] > 0 && !isS[j])
+            sa[buckets[text[j]]++] = j;
+    }
+
+    getBuckets(text, n, alphabet, buckets, true);
+    for (int32_t i = n - 1; i >= 0; i--) {
+        int32_t j = sa[i] - 1;
+        if (sa[i] > 0 && isS[j])
+            sa[--buckets[text[j]]] = j;
+    }
+}
+
+/**
+ * Core SA-IS recursion. text[n - 1] must be a unique smallest sentinel.
+ * The reduced problem is stored in the unused tail of sa, so no extra
+ * space proportional to n is needed beyond the type array.
+ */
+void SuffixArray::sais(const int32_t* text, int32_t* sa, int32_t n, int32_t alphabet) {
+    std::vector<char> isS(n);
+    isS[n - 1] = 1;
+    for (int32_t i = n - 2; i >= 0; i--)
+        isS[i] = text[i] < text[i + 1] || (text[i] == text[i + 1] && isS[i + 1]);
+
+    // Stage 1: sort LMS substrings
+    std::vector<int32_t> buckets(alphabet);
+    getBuckets(text, n, alphabet, buckets, true);
+    std::fill(sa, sa + n, -1);
+    for (int32_t i = 1; i < n; i++)
+        if (isLMS(isS, i))
+            sa[--buckets[text[i]]] = i;
+    induceSort(text, sa, n, alphabet, isS, buckets);
+
+    int32_t n1 = 0;
+    for (int32_t i = 0; i < n; i++)
+        if (isLMS(isS, sa[i]))
+            sa[n1++] = sa[i];
+
+    // Name LMS substrings; equal substrings share a name
+    std::fill(sa + n1, sa + n, -1);
+    int32_t names = 0;
+    int32_t prev = -1;
+    for (int32_t i = 0; i < n1; i++) {
+        int32_t pos = sa[i];
+        bool differs = false;
+        for (int32_t d = 0; d < n; d++) {
+            if (prev == -1 || text[pos + d] != text[prev + d] || isS[pos + d] != isS[prev + d]) {
+                differs = true;
+                break;
+            }
+            if (d > 0 && (isLMS(isS, pos + d) || isLMS(isS, prev + d)))
+                break;
+        }
+        if (differs) {
+            names++;
+            prev = pos;
+        }
+        sa[n1 + pos / 2] = names - 1;
+    }
+    for (int32_t i = n - 1, j = n - 1; i >= n1; i--)
+        if (sa[i] >= 0)
+            sa[j--] = sa[i];
+
+    // Stage 2: sort the reduced string, recursing only if names repeat
+    int32_t* sa1 = sa;
+    int32_t* s1 = sa + n - n1;
+    if (names < n1) {
+        sais(s1, sa1, n1, names);
+    } else {
+        for (int32_t i = 0; i < n1; i++)
+            sa1[s1[i]] = i;
+    }
+
+    // Stage 3: induce the full suffix array from the sorted LMS suffixes
+    getBuckets(text, n, alphabet, buckets, true);
+    for (int32_t i = 1, j = 0; i < n; i++)
+        if (isLMS(isS, i))
+            s1[j++] = i;
+    for (int32_t i = 0; i < n1; i++)
+        sa1[i] = s1[sa1[i]];
+    std::fill(sa + n1, sa + n, -1);
+    for (int32_t i = n1 - 1; i >= 0; i--) {
+        int32_t j = sa[i];
+        sa[i] = -1;
+        sa[--buckets[text[j]]] = j;
+    }
+    induceSort(text, sa, n, alphabet, isS, buckets);
+}
+
+std::vector<int32_t> SuffixArray::build(const std::string& text) {
+    int32_t n = static_cast<int32_t>(text.size());
+    std::vector<int32_t> sa;
+    if (n == 0) return sa;
+
+    // Append the sentinel, then drop its entry (always first) afterwards
+    std::vector<int32_t> symbols(n + 1);
+    for (int32_t i = 0; i < n; i++)
+        symbols[i] = static_cast<unsigned char>(text[i]);
+    symbols[n] = 0;
+
+    std::vector<int32_t> full(n + 1);
+    sais(symbols.data(), full.data(), n + 1, 256);
+    sa.assign(full.begin() + 1, full.end());
+    return sa;
+}
+
+std::vector<int32_t> SuffixArray::buildLCP(const std::string& text,
+                                           const std::vector<int32_t>& sa) {
+    int32_t n = static_cast<int32_t>(sa.size());
+    std::vector<int32_t> rank(n);
+    std::vector<int32_t> lcp(n, 0);
+    for (int32_t i = 0; i < n; i++)
+        rank[sa[i]] = i;
+
+    int32_t h = 0;
+    for (int32_t i = 0; i < n; i++) {
+        if (rank[i] > 0) {
+            int32_t j = sa[rank[i] - 1];
+            while (i + h < n && j + h < n && text[i + h] == text[j + h])
+                h++;
+            lcp[rank[i]] = h;
+            if (h > 0) h--;
+        } else {
+            h = 0;
+        }
+    }
+    return lcp;
+}
@@ -10,6 +10,11 @@ std::string Translator::normalizeSequence(const std::string& sequence) const {
     return result;
 }
 
+void Translator::normalizeInto(std::string_view sequence, std::string& out) const {
+    out.assign(sequence.data(), sequence.size());
+    std::transform(out.begin(), out.end(), out.begin(), ::toupper);
+}
+
 std::string Translator::transcribeDNAtoRNA(const std::string& dna) const {
     std::string normalized = normalizeSequence(dna);
     std::string mrna;
@@ -22,31 +27,67 @@ std::string Translator::transcribeDNAtoRNA(const std::string& dna) const {
 }
 
 std::string Translator::translateRNA(const std::string& mrna) const {
-    std::string normalized = normalizeSequence(mrna);
     std::string protein;
+    appendProtein(normalizeSequence(mrna), protein, nullptr, nullptr);
+    return protein;
+}
 
-    for (size_t i = 0; i + 2 < normalized.size(); i += 3) {
-        std::string rnaCodon = normalized.substr(i, 3);
-
-        // Convert RNA codon (U) back to DNA codon (T) for table lookup
-        std::string dnaCodon;
-        for (char c : rnaCodon) {
-            dnaCodon += (c == 'U') ? 'T' : c;
-        }
+void Translator::appendProtein(const std::string& mrna, std::string& protein,
+                               const MotifScanner* scanner,
+                               std::vector<MotifMatch>* matches) const {
+    int motifState = scanner ? scanner->initialState() : 0;
 
-        char aminoAcid = codonTable_.translateCodon(dnaCodon);
+    for (size_t i = 0; i + 2 < mrna.size(); i += 3) {
+        // The table accepts U as well as T, so no DNA codon is rebuilt
+        char aminoAcid = codonTable_.translateCodon(mrna[i], mrna[i + 1], mrna[i + 2]);
         if (aminoAcid == '*') {
             break;
         }
         protein += aminoAcid;
+
+        if (scanner) {
+            motifState = scanner->step(motifState, aminoAcid);
+            scanner->collect(motifState, static_cast<int>(protein.size()) - 1, *matches);
+        }
     }
+}
+
+std::string Translator::reverseComplement(const std::string& dna) const {
+    std::string result;
+    result.reserve(dna.size());
+
+    for (auto it = dna.rbegin(); it != dna.rend(); ++it) {
+        switch (std::toupper(static_cast<unsigned char>(*it))) {
+            case 'A': result += 'T'; break;
+            case 'T': result += 'A'; break;
+            case 'G': result += 'C'; break;
+            case 'C': result += 'G'; break;
+            default:  result += 'N'; break;
+        }
+    }
+    return result;
+}
+
+std::string Translator::translateFrame(const std::string& dna, int frame) const {
+    std::string strand = frame < 0 ? reverseComplement(dna) : normalizeSequence(dna);
+    size_t offset = static_cast<size_t>((frame < 0 ? -frame : frame) - 1);
+
+    std::string protein;
+    if (offset < strand.size())
+        protein.reserve((strand.size() - offset) / 3);
+
+    for (size_t i = offset; i + 2 < strand.size(); i += 3)
+        protein += codonTable_.translateCodon(strand[i], strand[i + 1], strand[i + 2]);
     return protein;
 }
 
 double Translator::calculateGCContent(const std::string& dna) const {
-    if (dna.empty()) return 0.0;
+    return gcPercent(normalizeSequence(dna));
+}
+
+double Translator::gcPercent(const std::string& normalized) const {
+    if (normalized.empty()) return 0.0;
 
-    std::string normalized = normalizeSequence(dna);
     int gcCount = 0;
 
     for (char nucleotide : normalized) {
@@ -59,9 +100,30 @@ double Translator::calculateGCContent(const std::string& dna) const {
 
 TranslationResult Translator::translate(const Sequence& sequence) const {
     TranslationResult result;
-    result.dna = normalizeSequence(sequence.getDNA());
-    result.mrna = transcribeDNAtoRNA(result.dna);
-    result.protein = translateRNA(result.mrna);
-    result.gcContent = calculateGCContent(result.dna);
+    translateInto(sequence.getDNA(), result, nullptr, nullptr);
     return result;
 }
+
+void Translator::translateInto(std::string_view dna, TranslationResult& result) const {
+    translateInto(dna, result, nullptr, nullptr);
+}
+
+void Translator::translateInto(std::string_view dna, TranslationResult& result,
+                               const MotifScanner& scanner,
+                               std::vector<MotifMatch>& matches) const {
+    translateInto(dna, result, &scanner, &matches);
+}
+
+void Translator::translateInto(std::string_view dna, TranslationResult& result,
+                               const MotifScanner* scanner,
+                               std::vector<MotifMatch>* matches) const {
+    normalizeInto(dna, result.dna);
+
+    result.mrna.assign(result.dna);
+    std::replace(result.mrna.begin(), result.mrna.end(), 'T', 'U');
+
+    result.protein.clear();
+    appendProtein(result.mrna, result.protein, scanner, matches);
+
+    result.gcContent = gcPercent(result.dna);
+}
@@ -0,0 +1,394 @@
+#include "view/html_report.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+static const size_t MAX_DETAILED_RECORDS = 100;
+static const size_t TRACK_BUCKETS = 400;
+static const int TRACK_WIDTH = 800;
+static const int TRACK_HEIGHT = 60;
+static const size_t GC_WINDOW = 20;
+static const int PREVIEW_CODONS = 60;
+static const int PREVIEW_COLUMNS = 120;
+
+static const char BASE_ORDER[] = "TCAG";
+static const char* BASE_COLORS[] = {"#d62728", "#1f77b4", "#2ca02c", "#ff7f0e"};
+
+/**
+ * Index of a codon in TCAG order (0-63), or -1 for invalid bases
+ */
+static int codonIndex(char first, char second, char third) {
+    auto base = [](char c) {
+        switch (c) {
+            case 'T': return 0;
+            case 'C': return 1;
+            case 'A': return 2;
+            case 'G': return 3;
+            default:  return -1;
+        }
+    };
+    int a = base(first);
+    int b = base(second);
+    int c = base(third);
+    if (a < 0 || b < 0 || c < 0) return -1;
+    return a * 16 + b * 4 + c;
+}
+
+// === TRACK DOWNSAMPLER ===
+
+TrackDownsampler::TrackDownsampler(size_t buckets)
+    : buckets_(buckets + buckets % 2), used_(0), span_(1) {}
+
+void TrackDownsampler::reset() {
+    used_ = 0;
+    span_ = 1;
+}
+
+void TrackDownsampler::add(double value) {
+    if (used_ == 0 || buckets_[used_ - 1].count == span_) {
+        if (used_ == buckets_.size()) {
+            // Every bucket is full: merge neighbours and double the span
+            for (size_t k = 0; k < used_ / 2; k++) {
+                const Bucket& left = buckets_[2 * k];
+                const Bucket& right = buckets_[2 * k + 1];
+                Bucket merged;
+                merged.min = std::min(left.min, right.min);
+                merged.max = std::max(left.max, right.max);
+                merged.sum = left.sum + right.sum;
+                merged.count = left.count + right.count;
+                buckets_[k] = merged;
+            }
+            used_ /= 2;
+            span_ *= 2;
+        }
+        buckets_[used_++] = {value, value, 0.0, 0};
+    }
+
+    Bucket& bucket = buckets_[used_ - 1];
+    bucket.min = std::min(bucket.min, value);
+    bucket.max = std::max(bucket.max, value);
+    bucket.sum += value;
+    bucket.count++;
+}
+
+size_t TrackDownsampler::size() const {
+    return used_;
+}
+
+double TrackDownsampler::getMin(size_t bucket) const {
+    return buckets_[bucket].min;
+}
+
+double TrackDownsampler::getMax(size_t bucket) const {
+    return buckets_[bucket].max;
+}
+
+double TrackDownsampler::getMean(size_t bucket) const {
+    return buckets_[bucket].sum / buckets_[bucket].count;
+}
+
+// === HTML REPORT ===
+
+HtmlReport::HtmlReport()
+    : records_(0), totalBases_(0), totalResidues_(0), gcBases_(0),
+      runCodons_(), recordCodons_(), gcHistogram_(),
+      gcTrack_(TRACK_BUCKETS),
+      baseTracks_{TrackDownsampler(TRACK_BUCKETS), TrackDownsampler(TRACK_BUCKETS),
+                  TrackDownsampler(TRACK_BUCKETS), TrackDownsampler(TRACK_BUCKETS)},
+      runGcTrack_(TRACK_BUCKETS) {}
+
+bool HtmlReport::open(const std::string& filepath) {
+    out_.open(filepath, std::ios::trunc);
+    if (!out_.is_open()) {
+        std::cerr << "Error: cannot write report '" << filepath << "'\n";
+        return false;
+    }
+    filepath_ = filepath;
+    out_ << std::fixed << std::setprecision(1);
+    writeHeader();
+    return true;
+}
+
+void HtmlReport::writeEscaped(std::string_view text) {
+    for (char c : text) {
+        switch (c) {
+            case '&': out_ << "&amp;"; break;
+            case '<': out_ << "&lt;"; break;
+            case '>': out_ << "&gt;"; break;
+            case '"': out_ << "&quot;"; break;
+            default:  out_ << c; break;
+        }
+    }
+}
+
+void HtmlReport::writeHeader() {
+    out_ << "<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n"
+         << "<title>DNA Protein Translator report</title>\n"
+         << "<style>\n"
+         << "body { font-family: sans-serif; margin: 2em; color: #222; }\n"
+         << "section { border-top: 1px solid #ccc; padding: 0.5em 0 1em; }\n"
+         << "h2 small { font-weight: normal; color: #666; }\n"
+         << "pre { background: #f6f6f6; padding: 0.5em; overflow-x: auto; }\n"
+         << "svg { display: block; margin: 0.5em 0; }\n"
+         << "svg text { font: 10px monospace; }\n"
+         << ".stats { color: #444; }\n"
+         << "</style>\n</head>\n<body>\n"
+         << "<h1>DNA Protein Translator report</h1>\n"
+         << "<p>Detailed panels for the first " << MAX_DETAILED_RECORDS
+         << " records; every record is included in the <a href=\"#summary\">run summary</a>.</p>\n";
+}
+
+void HtmlReport::countCodons(const TranslationResult& result, uint64_t counts[64]) const {
+    const std::string& dna = result.dna;
+    for (size_t i = 0; i + 2 < dna.size(); i += 3) {
+        int index = codonIndex(dna[i], dna[i + 1], dna[i + 2]);
+        if (index < 0) continue;
+        counts[index]++;
+        if (codonTable_.translateCodon(dna[i], dna[i + 1], dna[i + 2]) == '*') break;
+    }
+}
+
+void HtmlReport::addRecord(std::string_view name,
+                           std::string_view description,
+                           const TranslationResult& result,
+                           const PairwiseAlignment* alignment) {
+    records_++;
+    totalBases_ += result.dna.size();
+    totalResidues_ += result.protein.size();
+    for (char c : result.dna)
+        gcBases_ += (c == 'G' || c == 'C');
+
+    size_t bin = std::min<size_t>(19, static_cast<size_t>(result.gcContent / 5.0));
+    gcHistogram_[bin]++;
+    runGcTrack_.add(result.gcContent);
+
+    std::fill(recordCodons_, recordCodons_ + 64, 0);
+    countCodons(result, recordCodons_);
+    for (int k = 0; k < 64; k++)
+        runCodons_[k] += recordCodons_[k];
+
+    if (records_ <= MAX_DETAILED_RECORDS)
+        writeRecordPanel(name, description, result, alignment);
+}
+
+void HtmlReport::writeSequencePreview(const TranslationResult& result) {
+    int codons = static_cast<int>(result.dna.size() / 3);
+    int shown = std::min(codons, PREVIEW_CODONS);
+    int protLen = static_cast<int>(result.protein.size());
+    const int perRow = 20;
+
+    out_ << "<pre>";
+    for (int start = 0; start < shown; start += perRow) {
+        int end = std::min(start + perRow, shown);
+        out_ << "DNA     ";
+        for (int i = start; i < end; i++)
+            out_ << ' ' << std::string_view(result.dna).substr(i * 3, 3);
+        out_ << "\nmRNA    ";
+        for (int i = start; i < end; i++)
+            out_ << ' ' << std::string_view(result.mrna).substr(i * 3, 3);
+        // Translation ends at the stop codon; codons after it stay blank
+        out_ << "\nProtein ";
+        for (int i = start; i < end && i <= protLen; i++)
+            out_ << "  " << (i < protLen ? result.protein[i] : '*') << ' ';
+        out_ << "\n\n";
+    }
+    if (codons > shown)
+        out_ << "(first " << shown << " of " << codons << " codons)\n";
+    out_ << "</pre>\n";
+}
+
+void HtmlReport::writeAlignmentPreview(const PairwiseAlignment& alignment) {
+    int columns = static_cast<int>(alignment.alignedQuery.size());
+    int shown = std::min(columns, PREVIEW_COLUMNS);
+    double identity = columns > 0 ? 100.0 * alignment.identities / columns : 0.0;
+    const int perRow = 60;
+
+    out_ << "<p class=\"stats\">Alignment score " << alignment.score
+         << ", identity " << alignment.identities << "/" << columns
+         << " (" << identity << "%), gaps " << alignment.gaps << "</p>\n<pre>";
+
+    for (int start = 0; start < shown; start += perRow) {
+        int end = std::min(start + perRow, shown);
+        std::string_view query = std::string_view(alignment.alignedQuery).substr(start, end - start);
+        std::string_view reference = std::string_view(alignment.alignedReference).substr(start, end - start);
+
+        out_ << "Query ";
+        writeEscaped(query);
+        out_ << "\n      ";
+        for (size_t k = 0; k < query.size(); k++)
+            out_ << (query[k] == reference[k] && query[k] != '-' ? '|' : ' ');
+        out_ << "\nRef   ";
+        writeEscaped(reference);
+        out_ << "\n\n";
+    }
+    if (columns > shown)
+        out_ << "(first " << shown << " of " << columns << " columns)\n";
+    out_ << "</pre>\n";
+}
+
+/**
+ * Shaded min-max band with the bucket mean drawn on top
+ */
+void HtmlReport::writeMinMaxTrack(const TrackDownsampler& track, const char* label, double scale) {
+    size_t buckets = track.size();
+    if (buckets == 0) return;
+
+    double step = static_cast<double>(TRACK_WIDTH) / buckets;
+    auto y = [scale](double value) { return TRACK_HEIGHT - value / scale * TRACK_HEIGHT; };
+
+    out_ << "<svg width=\"" << TRACK_WIDTH << "\" height=\"" << TRACK_HEIGHT + 14 << "\">"
+         << "<rect width=\"" << TRACK_WIDTH << "\" height=\"" << TRACK_HEIGHT
+         << "\" fill=\"#fafafa\" stroke=\"#ddd\"/>"
+         << "<path fill=\"#9ecae1\" d=\"M";
+    for (size_t k = 0; k < buckets; k++)
+        out_ << ' ' << k * step << ',' << y(track.getMax(k)) << ' ' << (k + 1) * step << ',' << y(track.getMax(k));
+    for (size_t k = buckets; k-- > 0; )
+        out_ << ' ' << (k + 1) * step << ',' << y(track.getMin(k)) << ' ' << k * step << ',' << y(track.getMin(k));
+    out_ << " Z\"/><polyline fill=\"none\" stroke=\"#08519c\" points=\"";
+    for (size_t k = 0; k < buckets; k++)
+        out_ << (k + 0.5) * step << ',' << y(track.getMean(k)) << ' ';
+    out_ << "\"/><text x=\"2\" y=\"" << TRACK_HEIGHT + 12 << "\">" << label << "</text></svg>\n";
+}
+
+void HtmlReport::writeCompositionTrack() {
+    size_t buckets = baseTracks_[0].size();
+    if (buckets == 0) return;
+
+    double step = static_cast<double>(TRACK_WIDTH) / buckets;
+    out_ << "<svg width=\"" << TRACK_WIDTH << "\" height=\"" << TRACK_HEIGHT + 14 << "\">"
+         << "<rect width=\"" << TRACK_WIDTH << "\" height=\"" << TRACK_HEIGHT
+         << "\" fill=\"#fafafa\" stroke=\"#ddd\"/>";
+    for (int b = 0; b < 4; b++) {
+        out_ << "<polyline fill=\"none\" stroke=\"" << BASE_COLORS[b] << "\" points=\"";
+        for (size_t k = 0; k < buckets; k++)
+            out_ << (k + 0.5) * step << ','
+                 << TRACK_HEIGHT - baseTracks_[b].getMean(k) * TRACK_HEIGHT << ' ';
+        out_ << "\"/>";
+    }
+    out_ << "<text x=\"2\" y=\"" << TRACK_HEIGHT + 12 << "\">composition";
+    for (int b = 0; b < 4; b++)
+        out_ << " <tspan fill=\"" << BASE_COLORS[b] << "\">" << BASE_ORDER[b] << "</tspan>";
+    out_ << "</text></svg>\n";
+}
+
+/**
+ * 4 x 16 grid: rows are the first base, columns the second and third
+ */
+void HtmlReport::writeCodonHeatmap(const uint64_t counts[64], const char* title) {
+    const int cellWidth = 48;
+    const int cellHeight = 22;
+    uint64_t maxCount = *std::max_element(counts, counts + 64);
+
+    out_ << "<svg width=\"" << cellWidth * 16 << "\" height=\"" << cellHeight * 4 + 14 << "\">";
+    for (int index = 0; index < 64; index++) {
+        int row = index / 16;
+        int col = index % 16;
+        char codon[3] = {BASE_ORDER[index / 16], BASE_ORDER[(index / 4) % 4], BASE_ORDER[index % 4]};
+        double intensity = maxCount > 0 ? static_cast<double>(counts[index]) / maxCount : 0.0;
+
+        out_ << "<rect x=\"" << col * cellWidth << "\" y=\"" << row * cellHeight
+             << "\" width=\"" << cellWidth - 1 << "\" height=\"" << cellHeight - 1
+             << "\" fill=\"#3182bd\" fill-opacity=\"" << std::setprecision(2) << 0.05 + 0.95 * intensity
+             << std::setprecision(1) << "\"><title>" << std::string_view(codon, 3) << " ("
+             << codonTable_.translateCodon(codon[0], codon[1], codon[2]) << "): "
+             << counts[index] << "</title></rect>"
+             << "<text x=\"" << col * cellWidth + 3 << "\" y=\"" << row * cellHeight + 15 << "\">"
+             << std::string_view(codon, 3) << ' '
+             << codonTable_.translateCodon(codon[0], codon[1], codon[2]) << "</text>";
+    }
+    out_ << "<text x=\"2\" y=\"" << cellHeight * 4 + 12 << "\">" << title << "</text></svg>\n";
+}
+
+void HtmlReport::writeGCHistogram() {
+    const int barWidth = 38;
+    uint64_t maxCount = *std::max_element(gcHistogram_, gcHistogram_ + 20);
+
+    out_ << "<svg width=\"" << barWidth * 20 << "\" height=\"" << TRACK_HEIGHT + 14 << "\">";
+    for (int k = 0; k < 20; k++) {
+        double height = maxCount > 0
+            ? static_cast<double>(gcHistogram_[k]) / maxCount * TRACK_HEIGHT : 0.0;
+        out_ << "<rect x=\"" << k * barWidth << "\" y=\"" << TRACK_HEIGHT - height
+             << "\" width=\"" << barWidth - 2 << "\" height=\"" << height
+             << "\" fill=\"#31a354\"><title>" << k * 5 << "-" << k * 5 + 5 << "% GC: "
+             << gcHistogram_[k] << " records</title></rect>";
+    }
+    out_ << "<text x=\"2\" y=\"" << TRACK_HEIGHT + 12
+         << "\">records by GC% (0-100, 5% bins)</text></svg>\n";
+}
+
+void HtmlReport::writeRecordPanel(std::string_view name,
+                                  std::string_view description,
+                                  const TranslationResult& result,
+                                  const PairwiseAlignment* alignment) {
+    out_ << "<section>\n<h2>";
+    writeEscaped(name.empty() ? std::string_view("(unnamed)") : name);
+    if (!description.empty()) {
+        out_ << " <small>";
+        writeEscaped(description);
+        out_ << "</small>";
+    }
+    out_ << "</h2>\n<p class=\"stats\">" << result.dna.size() << " bp, "
+         << result.protein.size() << " aa, GC " << result.gcContent << "%</p>\n";
+
+    writeSequencePreview(result);
+    if (alignment)
+        writeAlignmentPreview(*alignment);
+
+    // GC and composition over fixed windows, downsampled to the track width
+    gcTrack_.reset();
+    for (TrackDownsampler& track : baseTracks_)
+        track.reset();
+
+    const std::string& dna = result.dna;
+    for (size_t start = 0; start < dna.size(); start += GC_WINDOW) {
+        size_t end = std::min(start + GC_WINDOW, dna.size());
+        int counts[4] = {};
+        for (size_t i = start; i < end; i++) {
+            switch (dna[i]) {
+                case 'T': counts[0]++; break;
+                case 'C': counts[1]++; break;
+                case 'A': counts[2]++; break;
+                case 'G': counts[3]++; break;
+            }
+        }
+        double length = static_cast<double>(end - start);
+        gcTrack_.add((counts[1] + counts[3]) / length * 100.0);
+        for (int b = 0; b < 4; b++)
+            baseTracks_[b].add(counts[b] / length);
+    }
+
+    writeMinMaxTrack(gcTrack_, "GC% per 20 bp window (min/max band, mean line)", 100.0);
+    writeCompositionTrack();
+    writeCodonHeatmap(recordCodons_, "codon usage");
+    out_ << "</section>\n";
+}
+
+void HtmlReport::writeSummary() {
+    double gc = totalBases_ > 0 ? 100.0 * gcBases_ / totalBases_ : 0.0;
+
+    out_ << "<section id=\"summary\">\n<h2>Run summary</h2>\n<p class=\"stats\">"
+         << records_ << " records, " << totalBases_ << " bp, " << totalResidues_
+         << " aa, overall GC " << gc << "%";
+    if (records_ > MAX_DETAILED_RECORDS)
+        out_ << " (" << records_ - MAX_DETAILED_RECORDS << " records without a detailed panel)";
+    out_ << "</p>\n";
+
+    writeGCHistogram();
+    writeMinMaxTrack(runGcTrack_, "GC% by record, in input order (min/max band, mean line)", 100.0);
+    writeCodonHeatmap(runCodons_, "codon usage, all records");
+    out_ << "</section>\n";
+}
+
+bool HtmlReport::close() {
+    if (!out_.is_open()) return false;
+
+    writeSummary();
+    out_ << "</body>\n</html>\n";
+    out_.close();
+
+    if (out_.fail()) {
+        std::cerr << "Error: failed while writing report '" << filepath_ << "'\n";
+        return false;
+    }
+    return true;
+}
@@ -109,6 +109,55 @@ void Visualizer::displayAlignment(const TranslationResult& result) const {
     }
 }
 
+void Visualizer::displayPairwiseAlignment(const PairwiseAlignment& alignment,
+                                          std::string_view queryName,
+                                          std::string_view referenceName) const {
+    printHeader("PAIRWISE ALIGNMENT");
+
+    const std::string& query = alignment.alignedQuery;
+    const std::string& reference = alignment.alignedReference;
+    int columns = static_cast<int>(query.size());
+    const int perRow = 50;
+
+    std::cout << "  Query:     " << (queryName.empty() ? std::string_view("query") : queryName) << "\n"
+              << "  Reference: " << referenceName << "\n"
+              << "  Score: " << alignment.score
+              << "  Identities: " << alignment.identities << "/" << columns
+              << "  Positives: " << alignment.positives << "/" << columns
+              << "  Gaps: " << alignment.gaps << "\n\n";
+
+    int queryPos = alignment.queryStart;
+    int refPos = alignment.referenceStart;
+
+    for (int start = 0; start < columns; start += perRow) {
+        int end = std::min(start + perRow, columns);
+        std::string match;
+        int queryEnd = queryPos;
+        int refEnd = refPos;
+
+        for (int k = start; k < end; k++) {
+            char a = query[k];
+            char b = reference[k];
+            if (a == '-' || b == '-') match += ' ';
+            else if (a == b) match += '|';
+            else if (ProteinAligner::substitutionScore(a, b) > 0) match += '+';
+            else match += '.';
+            if (a != '-') queryEnd++;
+            if (b != '-') refEnd++;
+        }
+
+        std::cout << "  Query " << std::right << std::setw(6) << queryPos << " "
+                  << query.substr(start, end - start) << " " << queryEnd - 1 << "\n"
+                  << std::string(15, ' ') << match << "\n"
+                  << "  Ref   " << std::setw(6) << refPos << " "
+                  << reference.substr(start, end - start) << " " << refEnd - 1 << "\n\n"
+                  << std::left;
+
+        queryPos = queryEnd;
+        refPos = refEnd;
+    }
+}
+
 void Visualizer::displayFull(const TranslationResult& result) const {
     displayAlignment(result);
     displayCodonMap(result);
@@ -0,0 +1,122 @@
+// Checks that the per-record pipeline stops allocating once its buffers
+// have seen the input: parse, translate with motif scanning, properties
+// and alignment. Global operator new is replaced with a counter.
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include "model/fasta_parser.h"
+#include "model/translator.h"
+#include "model/motif_scanner.h"
+#include "model/protein_properties.h"
+#include "model/protein_aligner.h"
+#include "model/translation_workspace.h"
+
+static std::atomic<size_t> allocations(0);
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// Small enough to stay one shard, so parseSharded starts no threads
+static std::string makeFasta(unsigned seed, int records) {
+    static const char BASES[] = "ACGT";
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> base(0, 3);
+    std::uniform_int_distribution<int> length(30, 900);
+
+    std::string fasta;
+    for (int r = 0; r < records; r++) {
+        fasta += ">rec" + std::to_string(r) + " synthetic record\n";
+        std::string dna = "ATG";
+        int codons = length(rng);
+        for (int i = 0; i < codons * 3; i++) dna += BASES[base(rng)];
+        for (size_t i = 0; i < dna.size(); i += 60)
+            fasta += dna.substr(i, 60) + "\n";
+    }
+    return fasta;
+}
+
+struct Pipeline {
+    FastaParser parser;
+    Translator translator;
+    MotifScanner motifs;
+    ProteinAnalyzer analyzer;
+    ProteinAligner aligner;
+    AlignmentOptions global;
+    AlignmentOptions local;
+    std::string reference;
+    std::vector<FastaShard> shards = std::vector<FastaShard>(1);
+    TranslationWorkspace workspace;
+    double checksum = 0;
+
+    size_t run(const std::string& fasta) {
+        size_t records = 0;
+        parser.parseSharded(fasta.data(), fasta.data() + fasta.size(), shards);
+        for (const FastaShard& shard : shards) {
+            for (const FastaRecord& record : shard.batch.records) {
+                workspace.matches.clear();
+                translator.translateInto(record.dna, workspace.result, motifs,
+                                         workspace.matches);
+                const std::string& protein = workspace.result.protein;
+
+                ProteinProperties props = analyzer.analyze(protein);
+                aligner.align(protein, reference, global, workspace.alignment,
+                              workspace.alignmentScratch);
+                checksum += props.molecularWeight + workspace.alignment.score;
+                aligner.align(protein, reference, local, workspace.alignment,
+                              workspace.alignmentScratch);
+                checksum += workspace.alignment.score + workspace.matches.size();
+                records++;
+            }
+        }
+        return records;
+    }
+};
+
+int main() {
+    Pipeline pipeline;
+    pipeline.motifs.addMotif("MK");
+    pipeline.motifs.addMotif("LSP");
+    pipeline.motifs.addMotif("GG");
+    pipeline.local.mode = AlignmentMode::Local;
+    pipeline.reference = "MVLSPADKTNVKAAWGKVGAHAGEYGAEALERMFLSFPTTKTYFPHFDLSHGSAQV";
+
+    const std::string fasta = makeFasta(42, 300);
+
+    // Warm-up: buffers and arena blocks grow to fit the largest record
+    pipeline.run(fasta);
+
+    allocations = 0;
+    size_t records = 0;
+    for (int pass = 0; pass < 3; pass++)
+        records += pipeline.run(fasta);
+    size_t counted = allocations;
+
+    std::printf("alloc_test: %zu records, %zu allocations after warm-up (checksum %.1f)\n",
+                records, counted, pipeline.checksum);
+
+    if (records == 0) {
+        std::printf("alloc_test: FAILED, no records parsed\n");
+        return 1;
+    }
+    if (counted != 0) {
+        std::printf("alloc_test: FAILED, steady-state pipeline allocated\n");
+        return 1;
+    }
+    return 0;
+}